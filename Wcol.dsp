@@ -1,320 +1,392 @@
-# Microsoft Developer Studio Project File - Name="wcol" - Package Owner=<4>
-# Microsoft Developer Studio Generated Build File, Format Version 6.00
-# ** DO NOT EDIT **
-
-# TARGTYPE "Win32 (x86) Application" 0x0101
-
-CFG=wcol - Win32 Debug
-!MESSAGE This is not a valid makefile. To build this project using NMAKE,
-!MESSAGE use the Export Makefile command and run
-!MESSAGE 
-!MESSAGE NMAKE /f "Wcol.mak".
-!MESSAGE 
-!MESSAGE You can specify a configuration when running NMAKE
-!MESSAGE by defining the macro CFG on the command line. For example:
-!MESSAGE 
-!MESSAGE NMAKE /f "Wcol.mak" CFG="wcol - Win32 Debug"
-!MESSAGE 
-!MESSAGE Possible choices for configuration are:
-!MESSAGE 
-!MESSAGE "wcol - Win32 Release" (based on "Win32 (x86) Application")
-!MESSAGE "wcol - Win32 Debug" (based on "Win32 (x86) Application")
-!MESSAGE 
-
-# Begin Project
-# PROP AllowPerConfigDependencies 0
-# PROP Scc_ProjName ""$/Wcol2", PDAAAAAA"
-# PROP Scc_LocalPath "."
-CPP=cl.exe
-MTL=midl.exe
-RSC=rc.exe
-
-!IF  "$(CFG)" == "wcol - Win32 Release"
-
-# PROP BASE Use_MFC 5
-# PROP BASE Use_Debug_Libraries 0
-# PROP BASE Output_Dir "Release"
-# PROP BASE Intermediate_Dir "Release"
-# PROP BASE Target_Dir ""
-# PROP Use_MFC 5
-# PROP Use_Debug_Libraries 0
-# PROP Output_Dir "Release"
-# PROP Intermediate_Dir "Release"
-# PROP Ignore_Export_Lib 0
-# PROP Target_Dir ""
-# ADD BASE CPP /nologo /MT /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_WINDOWS" /Yu"stdafx.h" /FD /c
-# ADD CPP /nologo /MT /W3 /GX /O2 /D "WIN32" /D "_WINDOWS" /D "UNIQ" /D "IRPROP" /FR /YX"stdafx.h" /FD /c
-# ADD BASE MTL /nologo /D "NDEBUG" /mktyplib203 /o "NUL" /win32
-# ADD MTL /nologo /D "NDEBUG" /mktyplib203 /o "NUL" /win32
-# ADD BASE RSC /l 0x409 /d "NDEBUG"
-# ADD RSC /l 0x409 /d "NDEBUG"
-BSC32=bscmake.exe
-# ADD BASE BSC32 /nologo
-# ADD BSC32 /nologo
-LINK32=link.exe
-# ADD BASE LINK32 /nologo /subsystem:windows /machine:I386
-# ADD LINK32 /nologo /subsystem:windows /machine:I386
-# SUBTRACT LINK32 /profile /debug
-
-!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
-
-# PROP BASE Use_MFC 5
-# PROP BASE Use_Debug_Libraries 1
-# PROP BASE Output_Dir "Debug"
-# PROP BASE Intermediate_Dir "Debug"
-# PROP BASE Target_Dir ""
-# PROP Use_MFC 5
-# PROP Use_Debug_Libraries 1
-# PROP Output_Dir "Debug"
-# PROP Intermediate_Dir "Debug"
-# PROP Ignore_Export_Lib 0
-# PROP Target_Dir ""
-# ADD BASE CPP /nologo /MTd /W3 /Gm /GX /Zi /Od /D "WIN32" /D "_DEBUG" /D "_WINDOWS" /Yu"stdafx.h" /FD /c
-# ADD CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_WINDOWS" /D "_DEBUG" /D "UNIQ" /D "DUMNOWIN" /Fr /Yu"stdafx.h" /FD /c
-# ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /o "NUL" /win32
-# ADD MTL /nologo /D "_DEBUG" /mktyplib203 /o "NUL" /win32
-# ADD BASE RSC /l 0x409 /d "_DEBUG"
-# ADD RSC /l 0x409 /d "_DEBUG"
-BSC32=bscmake.exe
-# ADD BASE BSC32 /nologo
-# ADD BSC32 /nologo
-LINK32=link.exe
-# ADD BASE LINK32 /nologo /subsystem:windows /debug /machine:I386 /pdbtype:sept
-# ADD LINK32 /nologo /subsystem:windows /profile /debug /machine:I386
-
-!ENDIF 
-
-# Begin Target
-
-# Name "wcol - Win32 Release"
-# Name "wcol - Win32 Debug"
-# Begin Group "Source Files"
-
-# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
-# Begin Source File
-
-SOURCE=.\bm.cpp
-
-!IF  "$(CFG)" == "wcol - Win32 Release"
-
-!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
-
-# ADD CPP /Yu
-
-!ENDIF 
-
-# End Source File
-# Begin Source File
-
-SOURCE=.\cat.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\cm.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\expr.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\group.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\item.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\logop.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\main.cpp
-
-!IF  "$(CFG)" == "wcol - Win32 Release"
-
-# ADD CPP /O2
-# SUBTRACT CPP /Fr
-
-!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
-
-!ENDIF 
-
-# End Source File
-# Begin Source File
-
-SOURCE=.\mexpr.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\physop.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\query.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\rules.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\ssp.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\stdafx.cpp
-# ADD CPP /Yc
-# End Source File
-# Begin Source File
-
-SOURCE=.\supp.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\tasks.cpp
-
-!IF  "$(CFG)" == "wcol - Win32 Release"
-
-# ADD CPP /w /W0 /O2
-
-!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
-
-# ADD CPP /Ze
-# SUBTRACT CPP /O<none>
-
-!ENDIF 
-
-# End Source File
-# Begin Source File
-
-SOURCE=.\wcol.cpp
-# End Source File
-# Begin Source File
-
-SOURCE=.\wcol.rc
-# End Source File
-# End Group
-# Begin Group "Header Files"
-
-# PROP Default_Filter "*.h"
-# Begin Source File
-
-SOURCE=.\bm.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\cat.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\cm.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\defs.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\global.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\item.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\logop.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\op.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\physop.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\query.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\resource.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\rules.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\ssp.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\stdafx.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\supp.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\tasks.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\wcol.h
-# End Source File
-# End Group
-# Begin Group "Resource Files"
-
-# PROP Default_Filter ""
-# Begin Source File
-
-SOURCE=.\res\wcol.ico
-# End Source File
-# Begin Source File
-
-SOURCE=.\res\wcol.rc2
-# End Source File
-# Begin Source File
-
-SOURCE=.\res\wcoldoc.ico
-# End Source File
-# End Group
-# Begin Group "Misc Files"
-
-# PROP Default_Filter ""
-# Begin Source File
-
-SOURCE=.\catalog
-# End Source File
-# Begin Source File
-
-SOURCE=.\Cm
-# End Source File
-# Begin Source File
-
-SOURCE=.\numbers.txt
-# End Source File
-# Begin Source File
-
-SOURCE=.\option
-# End Source File
-# Begin Source File
-
-SOURCE=.\query
-# End Source File
-# Begin Source File
-
-SOURCE=.\readme.txt
-# End Source File
-# Begin Source File
-
-SOURCE=.\ruleset
-# End Source File
-# End Group
-# End Target
-# End Project
+# Microsoft Developer Studio Project File - Name="wcol" - Package Owner=<4>
+# Microsoft Developer Studio Generated Build File, Format Version 6.00
+# ** DO NOT EDIT **
+
+# TARGTYPE "Win32 (x86) Application" 0x0101
+
+CFG=wcol - Win32 Debug
+!MESSAGE This is not a valid makefile. To build this project using NMAKE,
+!MESSAGE use the Export Makefile command and run
+!MESSAGE 
+!MESSAGE NMAKE /f "Wcol.mak".
+!MESSAGE 
+!MESSAGE You can specify a configuration when running NMAKE
+!MESSAGE by defining the macro CFG on the command line. For example:
+!MESSAGE 
+!MESSAGE NMAKE /f "Wcol.mak" CFG="wcol - Win32 Debug"
+!MESSAGE 
+!MESSAGE Possible choices for configuration are:
+!MESSAGE 
+!MESSAGE "wcol - Win32 Release" (based on "Win32 (x86) Application")
+!MESSAGE "wcol - Win32 Debug" (based on "Win32 (x86) Application")
+!MESSAGE 
+
+# Begin Project
+# PROP AllowPerConfigDependencies 0
+# PROP Scc_ProjName ""$/Wcol2", PDAAAAAA"
+# PROP Scc_LocalPath "."
+CPP=cl.exe
+MTL=midl.exe
+RSC=rc.exe
+
+!IF  "$(CFG)" == "wcol - Win32 Release"
+
+# PROP BASE Use_MFC 5
+# PROP BASE Use_Debug_Libraries 0
+# PROP BASE Output_Dir "Release"
+# PROP BASE Intermediate_Dir "Release"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 5
+# PROP Use_Debug_Libraries 0
+# PROP Output_Dir "Release"
+# PROP Intermediate_Dir "Release"
+# PROP Ignore_Export_Lib 0
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /MT /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_WINDOWS" /Yu"stdafx.h" /FD /c
+# ADD CPP /nologo /MT /W3 /GX /O2 /D "WIN32" /D "_WINDOWS" /D "UNIQ" /D "IRPROP" /FR /YX"stdafx.h" /FD /c
+# ADD BASE MTL /nologo /D "NDEBUG" /mktyplib203 /o "NUL" /win32
+# ADD MTL /nologo /D "NDEBUG" /mktyplib203 /o "NUL" /win32
+# ADD BASE RSC /l 0x409 /d "NDEBUG"
+# ADD RSC /l 0x409 /d "NDEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LINK32=link.exe
+# ADD BASE LINK32 /nologo /subsystem:windows /machine:I386
+# ADD LINK32 /nologo /subsystem:windows /machine:I386
+# SUBTRACT LINK32 /profile /debug
+
+!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
+
+# PROP BASE Use_MFC 5
+# PROP BASE Use_Debug_Libraries 1
+# PROP BASE Output_Dir "Debug"
+# PROP BASE Intermediate_Dir "Debug"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 5
+# PROP Use_Debug_Libraries 1
+# PROP Output_Dir "Debug"
+# PROP Intermediate_Dir "Debug"
+# PROP Ignore_Export_Lib 0
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /MTd /W3 /Gm /GX /Zi /Od /D "WIN32" /D "_DEBUG" /D "_WINDOWS" /Yu"stdafx.h" /FD /c
+# ADD CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_WINDOWS" /D "_DEBUG" /D "UNIQ" /D "DUMNOWIN" /Fr /Yu"stdafx.h" /FD /c
+# ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /o "NUL" /win32
+# ADD MTL /nologo /D "_DEBUG" /mktyplib203 /o "NUL" /win32
+# ADD BASE RSC /l 0x409 /d "_DEBUG"
+# ADD RSC /l 0x409 /d "_DEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LINK32=link.exe
+# ADD BASE LINK32 /nologo /subsystem:windows /debug /machine:I386 /pdbtype:sept
+# ADD LINK32 /nologo /subsystem:windows /profile /debug /machine:I386
+
+!ENDIF 
+
+# Begin Target
+
+# Name "wcol - Win32 Release"
+# Name "wcol - Win32 Debug"
+# Begin Group "Source Files"
+
+# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
+# Begin Source File
+
+SOURCE=.\advisor.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\bm.cpp
+
+!IF  "$(CFG)" == "wcol - Win32 Release"
+
+!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
+
+# ADD CPP /Yu
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=.\bound.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\cat.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\cm.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\exec.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\expr.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\group.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\greedy.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\item.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\logop.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\main.cpp
+
+!IF  "$(CFG)" == "wcol - Win32 Release"
+
+# ADD CPP /O2
+# SUBTRACT CPP /Fr
+
+!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=.\mexpr.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\physop.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\plan.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\query.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\rules.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\spill.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\ssp.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\stdafx.cpp
+# ADD CPP /Yc
+# End Source File
+# Begin Source File
+
+SOURCE=.\supp.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\tasks.cpp
+
+!IF  "$(CFG)" == "wcol - Win32 Release"
+
+# ADD CPP /w /W0 /O2
+
+!ELSEIF  "$(CFG)" == "wcol - Win32 Debug"
+
+# ADD CPP /Ze
+# SUBTRACT CPP /O<none>
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
+SOURCE=.\topk.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\trace.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\wcol.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\wcol.rc
+# End Source File
+# Begin Source File
+
+SOURCE=.\whatif.cpp
+# End Source File
+# End Group
+# Begin Group "Header Files"
+
+# PROP Default_Filter "*.h"
+# Begin Source File
+
+SOURCE=.\advisor.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\bm.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\bound.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\cat.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\cm.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\defs.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\exec.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\global.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\greedy.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\item.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\logop.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\op.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\physop.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\plan.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\query.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\resource.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\rules.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\spill.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\ssp.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\stdafx.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\supp.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\tasks.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\topk.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\trace.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\wcol.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\whatif.h
+# End Source File
+# End Group
+# Begin Group "Resource Files"
+
+# PROP Default_Filter ""
+# Begin Source File
+
+SOURCE=.\res\wcol.ico
+# End Source File
+# Begin Source File
+
+SOURCE=.\res\wcol.rc2
+# End Source File
+# Begin Source File
+
+SOURCE=.\res\wcoldoc.ico
+# End Source File
+# End Group
+# Begin Group "Misc Files"
+
+# PROP Default_Filter ""
+# Begin Source File
+
+SOURCE=.\catalog
+# End Source File
+# Begin Source File
+
+SOURCE=.\Cm
+# End Source File
+# Begin Source File
+
+SOURCE=.\numbers.txt
+# End Source File
+# Begin Source File
+
+SOURCE=.\option
+# End Source File
+# Begin Source File
+
+SOURCE=.\query
+# End Source File
+# Begin Source File
+
+SOURCE=.\readme.txt
+# End Source File
+# Begin Source File
+
+SOURCE=.\ruleset
+# End Source File
+# End Group
+# End Target
+# End Project
@@ -0,0 +1,344 @@
+/*
+advisor.cpp -  implementation of advising the indexes of a workload
+$Revision: 1 $
+Implements classes in advisor.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "advisor.h"
+#include "ssp.h"
+#include "cat.h"
+#include "cm.h"
+
+#define LINEWIDTH 256		// buffer length of one text line
+
+INDEX_ADVISOR::INDEX_ADVISOR(CString FileName) : Budget(-1)
+{
+	char TextLine[LINEWIDTH];
+	char Kind[LINEWIDTH];
+	char Coll[LINEWIDTH];
+	char Name[LINEWIDTH];
+	FILE * fp = fopen(FileName, "r");
+	if (fp == NULL)
+	{
+		OUTPUT("Cannot read the advisor file %s\r\n", FileName);
+		return;
+	}
+	while (fgets(TextLine, LINEWIDTH, fp) != NULL)
+	{
+		if (IsCommentOrBlankLine(TextLine)) continue;
+		CString Line = SkipSpace(TextLine);
+		Line.TrimRight();
+
+		int Length = 0;
+		if (sscanf(Line, " Budget: %lf", &Budget) == 1) continue;
+		if (sscanf(Line, " %255s %255s %n", Kind, Coll, &Length) == 2 && Length > 0 &&
+			(strcmp(Kind, "Index:") == 0 || strcmp(Kind, "BitIndex:") == 0))
+		{
+			CString Rest = Line.Mid(Length);
+			CString CollName = Coll;
+			CString IndexName;
+			if (sscanf(Rest, "%255[^ \t(]", Name) == 1) IndexName = Name;
+			Colls.Add(CollName);
+			Lines.Add(Rest);
+			Bit.Add(strcmp(Kind, "BitIndex:") == 0 ? 1 : 0);
+			Names.Add(IndexName);
+			Sizes.Add(-1);
+		}
+		else OUTPUT("Not a candidate index: %s\r\n", Line);
+	}
+	fclose(fp);
+}
+
+bool INDEX_ADVISOR::Collections(int Cand, CArray<int, int> & CollIds)
+{
+	int CollId = -1;
+	for (int i = 0; i < Ctx->CollTable.GetSize(); i++)
+		if (Ctx->CollTable[i] == Colls[Cand] && Ctx->Cat->GetCollProp(i) != NULL) CollId = i;
+	if (CollId < 0) return false;
+
+	CollIds.Add(CollId);
+	for (int RangeVar = 0; RangeVar < Ctx->CollTable.GetSize(); RangeVar++)
+		if (RangeVar != CollId && Ctx->Cat->GetBaseColl(RangeVar) == CollId &&
+			Ctx->Cat->GetCollProp(RangeVar) != NULL)
+			CollIds.Add(RangeVar);
+	return true;
+}
+
+// The base collection comes first in Colls, so the candidate is read for it
+// and copied to the range variables, as GET::GET() copies the indexes
+bool INDEX_ADVISOR::Add(int Cand, CArray<int, int> & CollIds)
+{
+	CArray<int, int> Colls;
+	if (!Collections(Cand, Colls)) return false;
+	CString Coll = Ctx->CollTable[Colls[0]];
+	CString Name;
+	int i;
+
+	if (Bit[Cand])
+	{
+		BIT_IND_PROP * BitIndProp = Ctx->Cat->ReadBitIndex(Coll, Lines[Cand], Name);
+		if (BitIndProp == NULL) return false;
+		INT_ARRAY * BitIndNames = Ctx->Cat->GetBitIndNames(Colls[0]);
+		for (i = 0; BitIndNames != NULL && i < BitIndNames->GetSize(); i++)
+			if (TruncName(GetBitIndName((*BitIndNames)[i])) == Name)
+			{
+				delete BitIndProp;
+				return false;
+			}
+
+		if (Sizes[Cand] < 0)
+		{
+			double Values = 1;
+			for (i = 0; i < BitIndProp->BitAttr->GetSize(); i++)
+				Values *= Ctx->Cat->GetAttr((*BitIndProp->BitAttr)[i])->CuCard;
+			Sizes[Cand] = ceil(Ctx->Cat->GetCollProp(Colls[0])->Card / Ctx->Cm->bit_bf()) * Values;
+		}
+		for (i = 1; i < Colls.GetSize(); i++)
+		{
+			BIT_IND_PROP * Copy = new BIT_IND_PROP;
+			*Copy = *BitIndProp;
+			Copy->update(Ctx->CollTable[Colls[i]]);
+			Ctx->Cat->AddBitIndex(Ctx->CollTable[Colls[i]], Name, Copy);
+		}
+		Ctx->Cat->AddBitIndex(Coll, Name, BitIndProp);
+	}
+	else
+	{
+		IND_PROP * IndProp = Ctx->Cat->ReadIndex(Coll, Lines[Cand], Name);
+		if (IndProp == NULL) return false;
+		INT_ARRAY * IndNames = Ctx->Cat->GetIndNames(Colls[0]);
+		for (i = 0; IndNames != NULL && i < IndNames->GetSize(); i++)
+			if (TruncName(GetIndName((*IndNames)[i])) == Name)
+			{
+				delete IndProp;
+				return false;
+			}
+
+		if (Sizes[Cand] < 0)
+			Sizes[Cand] = ceil(Ctx->Cat->GetCollProp(Colls[0])->Card / Ctx->Cm->index_bf());
+		for (i = 1; i < Colls.GetSize(); i++)
+		{
+			IND_PROP * Copy = new IND_PROP;
+			*Copy = *IndProp;
+			Copy->update(Ctx->CollTable[Colls[i]]);
+			Ctx->Cat->AddIndex(Ctx->CollTable[Colls[i]], Name, Copy);
+		}
+		Ctx->Cat->AddIndex(Coll, Name, IndProp);
+	}
+
+	Names[Cand] = Name;
+	for (i = 0; i < Colls.GetSize(); i++) CollIds.Add(Colls[i]);
+	return true;
+}
+
+void INDEX_ADVISOR::Remove(int Cand)
+{
+	CArray<int, int> Colls;
+	Collections(Cand, Colls);
+	for (int i = 0; i < Colls.GetSize(); i++)
+		if (Bit[Cand]) Ctx->Cat->RemoveBitIndex(Ctx->CollTable[Colls[i]], Names[Cand]);
+		else Ctx->Cat->RemoveIndex(Ctx->CollTable[Colls[i]], Names[Cand]);
+}
+
+// The winners of the groups which read no collection changed stay, so
+// optimize() costs only the others
+double INDEX_ADVISOR::Cost(int * Cands, int Size, CArray<int, int> & Stale, int & Groups)
+{
+	CArray<int, int> CollIds;
+	int i;
+	for (i = 0; i < Size; i++)
+		if (!Add(Cands[i], CollIds))
+		{
+			while (--i >= 0) Remove(Cands[i]);
+			Groups = -1;
+			return -1;
+		}
+
+	CString os = Describe(Cands[0]) + "\r\n";
+	if (Size == 2) os.Format("Indexes %s and %s\r\n", Names[Cands[0]], Names[Cands[1]]);
+	OUTPUT("%s", os);
+
+	CArray<int, int> Changed;
+	Changed.Copy(CollIds);
+	for (i = 0; i < Stale.GetSize(); i++) CollIds.Add(Stale[i]);
+
+	Ctx->TaskNo = 0;
+	Ctx->Memo_M_Exprs = 0;
+	Ctx->OptStat->DupMExpr = Ctx->OptStat->FiredRule = Ctx->OptStat->HashedMExpr = 0;
+	Groups = Ctx->Ssp->Invalidate(CollIds, false, false);
+	Ctx->Ssp->optimize();
+	double Cost = Ctx->Ssp->GetCost(Ctx->Ssp->GetRootGID(), Ctx->vc[0]->GetPhysProp());
+
+	for (i = 0; i < Size; i++) Remove(Cands[i]);
+	Stale.Copy(Changed);
+	return Cost;
+}
+
+void INDEX_ADVISOR::Evaluate(int QueryNo)
+{
+	int N = Lines.GetSize();
+	int First = Costs.GetSize();
+	int i, j;
+	Costs.SetSize(First + 1 + N + N * N);
+	for (i = First; i < Costs.GetSize(); i++) Costs[i] = -1;
+	QueryNos.Add(QueryNo);
+
+	OUTPUT("%s", "========  INDEX ADVISOR =========\r\n");
+	double Base = Ctx->Ssp->GetCost(Ctx->Ssp->GetRootGID(), Ctx->vc[0]->GetPhysProp());
+	if (Base < 0)
+	{
+		OUTPUT("%s", "No optimal plan to try the candidates with\r\n");
+		return;
+	}
+	Costs[First] = Base;
+	OUTPUT("Without the candidates, Cost = %s\r\n", COST(Base).Dump());
+
+	CArray<int, int> Stale;
+	int Cands[2];
+	int Groups;
+	CString os;
+	double StartMs = GetTimeMs();
+	for (i = 0; i < N; i++)
+	{
+		Cands[0] = i;
+		double With = Cost(Cands, 1, Stale, Groups);
+		if (Groups < 0)
+		{
+			os.Format("%s cannot be added to the catalog\r\n", Describe(i));
+			OUTPUT("%s", os);
+			continue;
+		}
+		Costs[First + 1 + i] = With;
+		OUTPUT("Groups costed again : %d\r\n", Groups);
+		OUTPUT("Cost = %s\r\n", COST(With).Dump());
+	}
+
+	// the pairs of candidates which lowered the cost alone
+	for (i = 0; i < N; i++)
+		for (j = i + 1; j < N; j++)
+		{
+			double One = Costs[First + 1 + i], Other = Costs[First + 1 + j];
+			if (One < 0 || One >= Base || Other < 0 || Other >= Base) continue;
+			Cands[0] = i;
+			Cands[1] = j;
+			double With = Cost(Cands, 2, Stale, Groups);
+			if (Groups < 0) continue;
+			Costs[First + 1 + N + i * N + j] = With;
+			OUTPUT("Groups costed again : %d\r\n", Groups);
+			OUTPUT("Cost = %s\r\n", COST(With).Dump());
+		}
+
+	// leave the search space costed with the catalog as it is
+	if (Stale.GetSize() > 0)
+	{
+		Ctx->Ssp->Invalidate(Stale, false, false);
+		Ctx->Ssp->optimize();
+	}
+	OUTPUT("Costing elapsed time : %.3f ms\r\n", GetTimeMs() - StartMs);
+}
+
+double INDEX_ADVISOR::QueryCost(int q, CArray<int, int> & In)
+{
+	int N = Lines.GetSize();
+	int First = q * (1 + N + N * N);
+	double Cost = Costs[First];
+	for (int i = 0; i < N; i++)
+	{
+		if (!In[i]) continue;
+		double One = Costs[First + 1 + i];
+		if (One >= 0 && One < Cost) Cost = One;
+		for (int j = i + 1; j < N; j++)
+		{
+			double Two = Costs[First + 1 + N + i * N + j];
+			if (In[j] && Two >= 0 && Two < Cost) Cost = Two;
+		}
+	}
+	return Cost;
+}
+
+CString INDEX_ADVISOR::Describe(int Cand)
+{
+	CString os;
+	os.Format("%s %s on %s", Bit[Cand] ? "Bit index" : "Index", Names[Cand], Colls[Cand]);
+	if (Sizes[Cand] >= 0)
+	{
+		CString Blocks;
+		Blocks.Format(", %.0f blocks", Sizes[Cand]);
+		os += Blocks;
+	}
+	return os;
+}
+
+// Each step adds the candidate which lowers the cost of the workload most
+// for each block it takes, the queries without a plan aside
+void INDEX_ADVISOR::Recommend()
+{
+	int N = Lines.GetSize();
+	int i, q;
+	CArray<int, int> In;
+	In.SetSize(N);
+	for (i = 0; i < N; i++) In[i] = 0;
+
+	double Before = 0, After = 0, Used = 0;
+	int Advised = 0;
+	for (q = 0; q < QueryNos.GetSize(); q++)
+		if (QueryCost(q, In) >= 0) Before += QueryCost(q, In);
+
+	OUTPUT("%s", "========  INDEXES ADVISED =========\r\n");
+	After = Before;
+	while (true)
+	{
+		int Best = -1;
+		double BestGain = 0, BestCost = 0;
+		for (i = 0; i < N; i++)
+		{
+			if (In[i] || Sizes[i] < 0) continue;
+			if (Budget >= 0 && Used + Sizes[i] > Budget) continue;
+			In[i] = 1;
+			double Cost = 0;
+			for (q = 0; q < QueryNos.GetSize(); q++)
+				if (QueryCost(q, In) >= 0) Cost += QueryCost(q, In);
+			In[i] = 0;
+			double Gain = (After - Cost) / (Sizes[i] > 1 ? Sizes[i] : 1);
+			if (Cost < After && Gain > BestGain)
+			{
+				Best = i;
+				BestGain = Gain;
+				BestCost = Cost;
+			}
+		}
+		if (Best < 0) break;
+		In[Best] = 1;
+		Used += Sizes[Best];
+		After = BestCost;
+		Advised++;
+		OUTPUT("%s\r\n", Describe(Best));
+	}
+
+	if (Advised == 0)
+		OUTPUT("%s", "No candidate lowers the cost of the workload\r\n");
+	CString os;
+	if (Budget >= 0) os.Format("Blocks : %.0f of %.0f\r\n", Used, Budget);
+	else os.Format("Blocks : %.0f\r\n", Used);
+	OUTPUT("%s", os);
+	os.Format("Workload: Cost = %s without them, %s with them\r\n",
+		COST(Before).Dump(), COST(After).Dump());
+	OUTPUT("%s", os);
+	for (q = 0; q < QueryNos.GetSize(); q++)
+	{
+		CArray<int, int> None;
+		None.SetSize(N);
+		for (i = 0; i < N; i++) None[i] = 0;
+		if (QueryCost(q, None) < 0) continue;
+		os.Format("Query %d: Cost = %s without them, %s with them\r\n",
+			QueryNos[q], COST(QueryCost(q, None)).Dump(), COST(QueryCost(q, In)).Dump());
+		OUTPUT("%s", os);
+	}
+}
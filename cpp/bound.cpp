@@ -0,0 +1,189 @@
+/*
+bound.cpp -  implementation of the lower bounds of groups
+$Revision: 1 $
+Implements classes in bound.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "bound.h"
+#include "ssp.h"
+#include "cat.h"
+#include "cm.h"
+
+// Copying out and fetching are the bound of the groups of logical
+// operators.  A GET copies nothing out, see TouchCopyCost().
+static double CopyCost(GROUP * Group)
+{
+	OP * Op = Group->GetFirstLogMExpr()->GetOp();
+	if (!Op->is_logical() || Op->GetName().Compare("GET") == 0) return 0;
+	return TouchCopyCost((LOG_COLL_PROP *)Group->get_log_prop());
+}
+
+double FETCH_BOUND::Find(GROUP * Group)
+{
+	if (!Group->GetFirstLogMExpr()->GetOp()->is_logical()) return 0;
+
+	double Cost = CopyCost(Group);
+	if (CuCardPruning) Cost += FetchingCost((LOG_COLL_PROP *)Group->get_log_prop());
+	return Cost;
+}
+
+// does the catalog have an index or a bit index on the collection?
+static bool Indexed(int CollId)
+{
+	INT_ARRAY * Indices = Ctx->Cat->GetIndNames(CollId);
+	INT_ARRAY * BitIndices = Ctx->Cat->GetBitIndNames(CollId);
+	return (Indices && Indices->GetSize()) || (BitIndices && BitIndices->GetSize());
+}
+
+// A table without an index is only read by FILE_SCAN, all of it.  The
+// others may be read through an index, for them FetchingCost() is kept.
+double SCAN_BOUND::Find(GROUP * Group)
+{
+	if (!Group->GetFirstLogMExpr()->GetOp()->is_logical()) return 0;
+
+	double Cost = CopyCost(Group);
+	if (!CuCardPruning) return Cost;
+
+	SCHEMA * Schema = ((LOG_COLL_PROP *)Group->get_log_prop())->Schema;
+	for (int i = 0; i < Schema->GetTableNum(); i++)
+	{
+		int CollId = Schema->GetTableId(i);
+		float Card = Schema->GetTableMaxCuCard(i);
+		if (CollId != 0 && !Indexed(CollId)) Card = Ctx->Cat->GetCollProp(CollId)->Card;
+		Cost += ceil(Card * Schema->GetTableWidth(i)) *
+			(Ctx->Cm->cpu_read() + Ctx->Cm->io());
+	}
+	return Cost;
+}
+
+static inline bool IsOp(GROUP * Group, const char * Name)
+{
+	return Group->GetFirstLogMExpr()->GetOp()->GetName().Compare(Name) == 0;
+}
+
+// The plans of a join of two tables are a join of the groups of the tables,
+// in either order.  The local costs are those of physop.cpp, less the terms
+// which may be 0.  LOOPS_INDEX_JOIN reads its right table through an index,
+// and BIT_JOIN through a bit index on a SELECT, so neither reads the plan of
+// its right input.
+double JOIN_BOUND::Find(GROUP * Group)
+{
+	if (!IsOp(Group, "EQJOIN")) return 0;
+	LOG_COLL_PROP * Prop = (LOG_COLL_PROP *)Group->get_log_prop();
+	if (Prop->Schema->GetTableNum() != 2) return 0;
+
+	M_EXPR * MExpr = Group->GetFirstLogMExpr();
+	GROUP * Inputs[2];
+	for (int i = 0; i < 2; i++)
+	{
+		Inputs[i] = Ctx->Ssp->GetGroup(MExpr->GetInput(i));
+		if (Inputs[i]->GetFirstLogMExpr() == NULL) return 0;
+		if (((LOG_COLL_PROP *)Inputs[i]->get_log_prop())->Schema->GetTableNum() != 1)
+			return 0;
+		Inputs[i]->RefineLowerBd();
+	}
+
+	CM * Cm = Ctx->Cm;
+	double OutputCard = Prop->Card;
+	double Copy = OutputCard * Cm->touch_copy();
+	double Best = -1;
+	for (int Left = 0; Left < 2; Left++)
+	{
+		GROUP * L = Inputs[Left];
+		GROUP * R = Inputs[1 - Left];
+		double LeftCard = ((LOG_COLL_PROP *)L->get_log_prop())->Card;
+		double RightCard = ((LOG_COLL_PROP *)R->get_log_prop())->Card;
+		double LeftBd = L->GetLowerBd()->GetValue();
+		double Both = LeftBd + R->GetLowerBd()->GetValue();
+
+		double Cost[5];
+		int Count = 0;
+		Cost[Count++] = LeftCard * RightCard * Cm->cpu_pred() + Copy + Both;	// LOOPS_JOIN
+		Cost[Count++] = (LeftCard + RightCard) * Cm->cpu_pred() + Copy + Both;	// MERGE_JOIN
+		Cost[Count++] = RightCard * Cm->hash_cost() + LeftCard * Cm->hash_probe()
+			+ Copy + Both;														// HASH_JOIN
+		if (IsOp(R, "GET"))
+		{
+			if (Indexed(((GET *)R->GetFirstLogMExpr()->GetOp())->GetCollection()))
+				Cost[Count++] = LeftCard * Cm->index_probe()
+					+ OutputCard * (2 * Cm->cpu_read() + Cm->touch_copy()) + LeftBd;	// LOOPS_INDEX_JOIN
+		}
+		else
+			Cost[Count++] = LeftCard * (Cm->cpu_read() + Cm->cpu_pred())
+				+ (LeftCard / Cm->bit_bf()) * Cm->io() + LeftBd;				// BIT_JOIN
+
+		for (int i = 0; i < Count; i++)
+			if (Best == -1 || Cost[i] < Best) Best = Cost[i];
+	}
+	// physop.cpp rounds the cards to float, the bound must not be above
+	// what it finds
+	return Best * (1 - 1e-6);
+}
+
+// The winner for any property is the cheapest plan of the group, when the
+// search found it.  A plan found with global epsilon pruning, or before the
+// search halted, may not be the cheapest.
+double WINNER_BOUND::Find(GROUP * Group)
+{
+#ifdef IRPROP
+	return 0;
+#else
+	if (Ctx->GlobepsPruning || Halt) return 0;
+
+	WINNER * Winner = Group->GetAnyWinner();
+	if (Winner == NULL || !Winner->GetDone()) return 0;
+	double Cost = Winner->GetCost()->GetValue();
+	return Cost == -1 ? 0 : Cost;	// no plan at all, left to the search
+#endif
+}
+
+LOWER_BOUND::LOWER_BOUND(CString Names)
+{
+	CString Rest = Names;
+	while (!Rest.IsEmpty())
+	{
+		int Comma = Rest.Find(',');
+		CString Name = Comma < 0 ? Rest : Rest.Left(Comma);
+		Rest = Comma < 0 ? CString("") : Rest.Mid(Comma + 1);
+
+		if (Name == "fetch") Bounds.Add(new FETCH_BOUND);
+		else if (Name == "scan") Bounds.Add(new SCAN_BOUND);
+		else if (Name == "join") Bounds.Add(new JOIN_BOUND);
+		else if (Name == "winner") Bounds.Add(new WINNER_BOUND);
+		else OUTPUT_ERROR("unknown lower bound");
+	}
+}
+
+LOWER_BOUND::~LOWER_BOUND()
+{
+	for (int i = 0; i < Bounds.GetSize(); i++) delete Bounds[i];
+}
+
+double LOWER_BOUND::Find(GROUP * Group)
+{
+	double Cost = 0;
+	for (int i = 0; i < Bounds.GetSize(); i++)
+	{
+		double Bound = Bounds[i]->Find(Group);
+		if (Bound > Cost) Cost = Bound;
+	}
+	return Cost;
+}
+
+CString LOWER_BOUND::Dump()
+{
+	CString os;
+	for (int i = 0; i < Bounds.GetSize(); i++)
+	{
+		if (i) os += ",";
+		os += Bounds[i]->GetName();
+	}
+	return os;
+}
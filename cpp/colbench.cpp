@@ -0,0 +1,585 @@
+/*
+colbench.cpp -  benchmark driver of the columbia optimizer
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  Runs every query of a suite under every rule set and option setting of
+  the suite, a number of times each, and reports the optimization time
+  (min, median, mean, standard deviation), the task and M_EXPR counters
+  and the peak memory as CSV or JSON.  The result can be compared with a
+  stored baseline, so that a change which makes the search slower or
+  larger is caught.
+
+  The suite file has one keyword per line, comments start with //.
+  Relative file names are taken relative to the current directory.
+
+	CM: file					cost model
+	Catalog: file				catalog for the following queries
+	Query: file					a single query file
+	Batch: file					a batch query file, each query is reported
+	RuleSet: file				a rule set, every query runs under every rule set
+	Config: name [flags]		an option setting, every query runs under every
+								setting.  Flags are Pruning, CuCardPruning,
+								GlobepsPruning=eps, Halt=grp,win,impr,
+								Fallback=tables,mexprs, Memory=mb, Spill=file
+								and Snapshot=file, which starts each query from
+								a snapshot; flags which are not given are off.
+	OnlyConfig: name ...		the following queries run only under the named
+								settings, an empty list means all settings.
+								The exhaustive settings are too slow for the
+								larger queries.
+	OnlyRuleSet: file			the following queries run only under this rule
+								set, an empty name means all rule sets.
+	Repeat: n					number of runs of each query (default 3)
+*/
+
+#include "stdafx.h"
+
+#include <algorithm>
+
+// outside references, all defined in global.h
+extern CString SQueryFile;
+extern CString BQueryFile;
+extern CString CatFile;
+extern CString CMFile;
+extern CString RSFile;
+extern CString AppDir;
+extern double GLOBAL_EPS;
+
+void Optimizer();
+
+#define LINEWIDTH 1024		// buffer length of one text line
+
+// an option setting of the optimizer
+class BENCH_CONFIG
+{
+public:
+	CString	Name;
+	bool	Pruning;
+	bool	CuCardPruning;
+	bool	GlobepsPruning;
+	double	Eps;
+	bool	Halt;
+	int		HaltGrpSize;
+	int		HaltWinSize;
+	int		HaltImpr;
+	int		FallbackTables;
+	int		FallbackMExprs;
+	int		MemoryBudget;
+	CString	SpillFile;
+	CString	SnapshotIn;
+
+	BENCH_CONFIG() : Pruning(false), CuCardPruning(false), GlobepsPruning(false),
+		Eps(0), Halt(false), HaltGrpSize(100), HaltWinSize(3), HaltImpr(20),
+		FallbackTables(0), FallbackMExprs(0), MemoryBudget(0)
+	{};
+
+	// make this the setting of the optimizer
+	void Apply()
+	{
+		::Pruning = Pruning;
+		::CuCardPruning = CuCardPruning;
+		Ctx->GlobepsPruning = GlobepsPruning;
+		if (GlobepsPruning) GLOBAL_EPS = Eps;
+		::Halt = Halt;
+		::HaltGrpSize = HaltGrpSize;
+		::HaltWinSize = HaltWinSize;
+		::HaltImpr = HaltImpr;
+		::FallbackTables = FallbackTables;
+		::FallbackMExprs = FallbackMExprs;
+		::MemoryBudget = MemoryBudget;
+		::SpillFile = SpillFile;
+		::SnapshotIn = SnapshotIn;
+	};
+};
+
+// a query file of the suite with its catalog
+class BENCH_QUERY
+{
+public:
+	CString	Catalog;
+	CString	File;
+	bool	Batch;
+	CString	OnlyConfig;		// " name name ", settings to run under, empty for all
+	CString	OnlyRuleSet;	// rule set to run under, empty for all
+
+	bool RunsUnder(CString & RuleSet, BENCH_CONFIG & Config)
+	{
+		return (OnlyRuleSet.IsEmpty() || OnlyRuleSet == RuleSet) &&
+			(OnlyConfig.IsEmpty() || OnlyConfig.Find(" " + Config.Name + " ") >= 0);
+	};
+};
+
+// the result of all runs of one query under one rule set and setting
+class BENCH_RESULT
+{
+public:
+	CString	Query;			// query file, with #n for the n-th query of a batch
+	CString	RuleSet;
+	CString	Config;
+	int		Runs;
+	double	MinMs;
+	double	MedianMs;
+	double	MeanMs;
+	double	StdDevMs;
+	int		TotalTask;
+	int		TotalMExpr;
+	int		MemoMExpr;
+	int		DupMExpr;
+	int		MaxBucket;
+	int		PeakMemory;		// largest of all runs
+	double	Cost;
+
+	BENCH_RESULT() : Runs(0), MinMs(0), MedianMs(0), MeanMs(0), StdDevMs(0),
+		TotalTask(0), TotalMExpr(0), MemoMExpr(0), DupMExpr(0), MaxBucket(0),
+		PeakMemory(0), Cost(-1)
+	{};
+
+	CString Key() { return Query + "|" + RuleSet + "|" + Config; };
+
+	static CString CSVHeader()
+	{
+		return "query,ruleset,config,runs,min_ms,median_ms,mean_ms,stddev_ms,"
+			"total_task,total_mexpr,memo_mexpr,dup_mexpr,max_bucket,peak_memory,cost\n";
+	};
+
+	CString DumpCSV()
+	{
+		CString os;
+		os.Format("\"%s\",\"%s\",\"%s\",%d,%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%d,%d,%d,%g\n",
+			Query, RuleSet, Config, Runs, MinMs, MedianMs, MeanMs, StdDevMs,
+			TotalTask, TotalMExpr, MemoMExpr, DupMExpr, MaxBucket, PeakMemory, Cost);
+		return os;
+	};
+
+	CString DumpJSON()
+	{
+		CString os;
+		os.Format("{\"query\": \"%s\", \"ruleset\": \"%s\", \"config\": \"%s\", \"runs\": %d, "
+			"\"min_ms\": %.3f, \"median_ms\": %.3f, \"mean_ms\": %.3f, \"stddev_ms\": %.3f, "
+			"\"total_task\": %d, \"total_mexpr\": %d, \"memo_mexpr\": %d, \"dup_mexpr\": %d, "
+			"\"max_bucket\": %d, \"peak_memory\": %d, \"cost\": %g}",
+			Query, RuleSet, Config, Runs, MinMs, MedianMs, MeanMs, StdDevMs,
+			TotalTask, TotalMExpr, MemoMExpr, DupMExpr, MaxBucket, PeakMemory, Cost);
+		return os;
+	};
+
+	// read back a line written by DumpCSV(), false if it is not one
+	bool ParseCSV(char * p);
+};
+
+static CArray<BENCH_QUERY, BENCH_QUERY&>	Queries;
+static CArray<CString, CString&>			RuleSets;
+static CArray<BENCH_CONFIG, BENCH_CONFIG&>	Configs;
+static int Repeat = 3;
+
+// file name without the directory, used to label rule sets
+static CString BaseName(CString Name)
+{
+	int Pos = MAX(Name.ReverseFind('/'), Name.ReverseFind('\\'));
+	return Name.Mid(Pos + 1);
+}
+
+// the rest of the line after a keyword, without surrounding blanks
+static CString Value(char * p, const char * Keyword)
+{
+	CString Result = SkipSpace(p + strlen(Keyword));
+	Result.TrimRight();
+	return Result;
+}
+
+static void ReadSuite(const char * SuiteFile)
+{
+	FILE * fp = fopen(SuiteFile, "r");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "can not open suite file %s\n", SuiteFile);
+		exit(1);
+	}
+
+	CString Catalog;
+	CString OnlyConfig, OnlyRuleSet;
+	char TextLine[LINEWIDTH];
+	while (fgets(TextLine, LINEWIDTH, fp))
+	{
+		if (IsCommentOrBlankLine(TextLine)) continue;
+		char * p = SkipSpace(TextLine);
+
+		if (p == strstr(p, "CM:")) CMFile = Value(p, "CM:");
+		else if (p == strstr(p, "Catalog:")) Catalog = Value(p, "Catalog:");
+		else if (p == strstr(p, "RuleSet:"))
+		{
+			CString RuleSet = Value(p, "RuleSet:");
+			RuleSets.Add(RuleSet);
+		}
+		else if (p == strstr(p, "Repeat:")) Repeat = atoi(Value(p, "Repeat:"));
+		else if (p == strstr(p, "OnlyConfig:"))
+		{
+			OnlyConfig = Value(p, "OnlyConfig:");
+			if (!OnlyConfig.IsEmpty()) OnlyConfig = " " + OnlyConfig + " ";
+		}
+		else if (p == strstr(p, "OnlyRuleSet:")) OnlyRuleSet = Value(p, "OnlyRuleSet:");
+		else if (p == strstr(p, "Query:") || p == strstr(p, "Batch:"))
+		{
+			BENCH_QUERY Query;
+			Query.Batch = (p == strstr(p, "Batch:"));
+			Query.Catalog = Catalog;
+			Query.OnlyConfig = OnlyConfig;
+			Query.OnlyRuleSet = OnlyRuleSet;
+			Query.File = Value(p, Query.Batch ? "Batch:" : "Query:");
+			if (Catalog.IsEmpty())
+			{
+				fprintf(stderr, "%s: Catalog: must come before %s\n", SuiteFile, (LPCTSTR)Query.File);
+				exit(1);
+			}
+			Queries.Add(Query);
+		}
+		else if (p == strstr(p, "Config:"))
+		{
+			BENCH_CONFIG Config;
+			CString Flags = Value(p, "Config:") + " ";
+
+			// first word is the name, the others are flags
+			int Pos = Flags.Find(' ');
+			Config.Name = Flags.Left(Pos);
+			for (;;)
+			{
+				Flags = Flags.Mid(Pos + 1);
+				Flags.TrimLeft();
+				if (Flags.IsEmpty()) break;
+				Pos = Flags.Find(' ');
+				CString Flag = Flags.Left(Pos);
+
+				if (Flag == "Pruning") Config.Pruning = true;
+				else if (Flag == "CuCardPruning") Config.CuCardPruning = true;
+				else if (Flag.Left(15) == "GlobepsPruning=")
+				{
+					Config.GlobepsPruning = true;
+					Config.Eps = atof(Flag.Mid(15));
+				}
+				else if (Flag.Left(5) == "Halt=")
+				{
+					Config.Halt = true;
+					sscanf(Flag.Mid(5), "%d,%d,%d", &Config.HaltGrpSize,
+						&Config.HaltWinSize, &Config.HaltImpr);
+				}
+				else if (Flag.Left(9) == "Fallback=")
+					sscanf(Flag.Mid(9), "%d,%d", &Config.FallbackTables, &Config.FallbackMExprs);
+				else if (Flag.Left(7) == "Memory=")
+					Config.MemoryBudget = atoi(Flag.Mid(7));
+				else if (Flag.Left(6) == "Spill=")
+					Config.SpillFile = Flag.Mid(6);
+				else if (Flag.Left(9) == "Snapshot=")
+					Config.SnapshotIn = Flag.Mid(9);
+				else
+				{
+					fprintf(stderr, "%s: unknown flag %s\n", SuiteFile, (LPCTSTR)Flag);
+					exit(1);
+				}
+			}
+			Configs.Add(Config);
+		}
+		else
+		{
+			fprintf(stderr, "%s: can not understand %s", SuiteFile, p);
+			exit(1);
+		}
+	}
+	fclose(fp);
+
+	if (Configs.GetSize() == 0)
+	{
+		// the default setting of the option dialog
+		BENCH_CONFIG Config;
+		Config.Name = "default";
+		Config.Pruning = Config.CuCardPruning = true;
+		Configs.Add(Config);
+	}
+	if (Queries.GetSize() == 0 || RuleSets.GetSize() == 0 || CMFile == "cm")
+	{
+		fprintf(stderr, "%s: needs CM:, at least one RuleSet: and at least one Query:\n", SuiteFile);
+		exit(1);
+	}
+}
+
+// split one line of CSV into fields; fields may be quoted
+static void SplitCSV(char * p, CArray<CString, CString&> & Fields)
+{
+	Fields.RemoveAll();
+	for (;;)
+	{
+		CString Field;
+		if (*p == '"')
+		{
+			for (p++; *p && *p != '"'; p++) Field += *p;
+			if (*p == '"') p++;
+		}
+		else
+			for (; *p && *p != ',' && *p != '\n'; p++) Field += *p;
+		Fields.Add(Field);
+		if (*p != ',') break;
+		p++;
+	}
+}
+
+bool BENCH_RESULT::ParseCSV(char * p)
+{
+	CArray<CString, CString&> Fields;
+	SplitCSV(p, Fields);
+	if (Fields.GetSize() != 15 || Fields[0] == "query") return false;
+
+	Query = Fields[0]; RuleSet = Fields[1]; Config = Fields[2];
+	Runs = atoi(Fields[3]);
+	MinMs = atof(Fields[4]); MedianMs = atof(Fields[5]);
+	MeanMs = atof(Fields[6]); StdDevMs = atof(Fields[7]);
+	TotalTask = atoi(Fields[8]); TotalMExpr = atoi(Fields[9]);
+	MemoMExpr = atoi(Fields[10]); DupMExpr = atoi(Fields[11]);
+	MaxBucket = atoi(Fields[12]); PeakMemory = atoi(Fields[13]);
+	Cost = atof(Fields[14]);
+	return true;
+}
+
+// Run one query file under the current setting and add one result per query
+static void RunQuery(BENCH_QUERY & Query, CString & RuleSet, BENCH_CONFIG & Config,
+					 CArray<BENCH_RESULT, BENCH_RESULT&> & Results)
+{
+	CatFile = Query.Catalog;
+	RSFile = RuleSet;
+	if (Query.Batch) { RadioVal = 0; BQueryFile = Query.File; }
+	else { RadioVal = 1; SQueryFile = Query.File; }
+	Config.Apply();
+
+	// Times[q * Repeat + Run] for the q-th query of the file
+	CArray<double, double> Times;
+	int First = Results.GetSize();
+	int NumQuery = 0;
+
+	for (int Run = 0; Run < Repeat; Run++)
+	{
+		Optimizer();
+
+		for (int q = 0; q < QueryStats.GetSize(); q++)
+		{
+			QUERY_STAT & Stat = QueryStats[q];
+			if (Run == 0)
+			{
+				// the counters do not depend on the run, take them once
+				BENCH_RESULT Result;
+				Result.Query = Query.File;
+				if (Query.Batch)
+				{
+					CString Suffix;
+					Suffix.Format("#%d", Stat.QueryNo);
+					Result.Query += Suffix;
+				}
+				Result.RuleSet = BaseName(RuleSet);
+				Result.Config = Config.Name;
+				Result.TotalTask = Stat.TotalTask;
+				Result.TotalMExpr = Stat.TotalMExpr;
+				Result.MemoMExpr = Stat.MemoMExpr;
+				Result.DupMExpr = Stat.DupMExpr;
+				Result.MaxBucket = Stat.MaxBucket;
+				Result.Cost = Stat.Cost;
+				Results.Add(Result);
+				NumQuery++;
+				Times.SetSize(NumQuery * Repeat);
+			}
+			if (q >= NumQuery) continue;	// should not happen
+
+			Times[q * Repeat + Run] = Stat.ElapsedMs;
+			BENCH_RESULT & Result = Results[First + q];
+			Result.PeakMemory = MAX(Result.PeakMemory, Stat.PeakMemory);
+		}
+	}
+
+	// summarize the times
+	for (int q = 0; q < NumQuery; q++)
+	{
+		BENCH_RESULT & Result = Results[First + q];
+		int n = Repeat;
+		double * T = Times.GetData() + q * Repeat;
+		std::sort(T, T + n);
+		double Sum = 0, SumSq = 0;
+		for (int i = 0; i < n; i++) Sum += T[i];
+		Result.Runs = n;
+		Result.MinMs = T[0];
+		Result.MedianMs = (n % 2) ? T[n / 2] : (T[n / 2 - 1] + T[n / 2]) / 2;
+		Result.MeanMs = Sum / n;
+		for (int i = 0; i < n; i++) SumSq += (T[i] - Result.MeanMs) * (T[i] - Result.MeanMs);
+		Result.StdDevMs = n > 1 ? sqrt(SumSq / (n - 1)) : 0;
+	}
+}
+
+// Compare with the baseline.  A result regresses if its median time, one
+// of its search space counters or its peak memory grew by more than
+// Tolerance (a fraction).  Small absolute changes of time and memory are
+// taken as noise.  Returns the number of regressions.
+static int CompareBaseline(const char * BaselineFile, double Tolerance,
+						   CArray<BENCH_RESULT, BENCH_RESULT&> & Results)
+{
+	FILE * fp = fopen(BaselineFile, "r");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "can not open baseline %s\n", BaselineFile);
+		exit(1);
+	}
+	CArray<BENCH_RESULT, BENCH_RESULT&> Baseline;
+	char TextLine[LINEWIDTH];
+	while (fgets(TextLine, LINEWIDTH, fp))
+	{
+		BENCH_RESULT Result;
+		if (Result.ParseCSV(TextLine)) Baseline.Add(Result);
+	}
+	fclose(fp);
+
+	int Regressions = 0, Compared = 0;
+	for (int r = 0; r < Results.GetSize(); r++)
+	{
+		BENCH_RESULT & Now = Results[r];
+		int b;
+		for (b = 0; b < Baseline.GetSize(); b++)
+			if (Baseline[b].Key() == Now.Key()) break;
+		if (b == Baseline.GetSize())
+		{
+			fprintf(stderr, "new:        %s\n", (LPCTSTR)Now.Key());
+			continue;
+		}
+		BENCH_RESULT & Base = Baseline[b];
+		Compared++;
+
+		struct { const char * Name; double Base, Now, Noise; } Metric[] =
+		{
+			{ "median_ms",   Base.MedianMs,   Now.MedianMs,   5.0 },
+			{ "total_task",  Base.TotalTask,  Now.TotalTask,  0 },
+			{ "total_mexpr", Base.TotalMExpr, Now.TotalMExpr, 0 },
+			{ "memo_mexpr",  Base.MemoMExpr,  Now.MemoMExpr,  0 },
+			{ "peak_memory", Base.PeakMemory, Now.PeakMemory, 1024 * 1024 },
+		};
+		for (int m = 0; m < (int)slotsof(Metric); m++)
+		{
+			if (Metric[m].Now - Metric[m].Base <= Metric[m].Noise) continue;
+			if (Metric[m].Now <= Metric[m].Base * (1 + Tolerance)) continue;
+
+			fprintf(stderr, "regression: %s %s %.3f -> %.3f (%+.1f%%)\n",
+				(LPCTSTR)Now.Key(), Metric[m].Name, Metric[m].Base, Metric[m].Now,
+				Metric[m].Base > 0 ? (Metric[m].Now / Metric[m].Base - 1) * 100 : 100.0);
+			Regressions++;
+		}
+		if (Base.Cost != -1 && fabs(Now.Cost - Base.Cost) > 1e-3 * fabs(Base.Cost))
+			fprintf(stderr, "cost:       %s %g -> %g\n", (LPCTSTR)Now.Key(), Base.Cost, Now.Cost);
+	}
+	fprintf(stderr, "%d results compared with %s, %d regressions\n",
+		Compared, BaselineFile, Regressions);
+
+	return Regressions;
+}
+
+static void Usage(const char * Prog)
+{
+	fprintf(stderr,
+		"usage: %s suite [options]\n"
+		"  -n runs      number of runs of each query, overrides Repeat: of the suite\n"
+		"  -j           write JSON instead of CSV\n"
+		"  -o file      write the results to file instead of stdout\n"
+		"  -f text      only queries whose file name contains text\n"
+		"  -B file      compare with a baseline written earlier as CSV\n"
+		"  -T percent   tolerance of the baseline comparison (default 25)\n"
+		"  -d dir       directory for colout.txt, script.cove and tempquery (default .)\n",
+		Prog);
+	exit(1);
+}
+
+int main(int argc, char * argv[])
+{
+	const char * SuiteFile = NULL;
+	const char * OutFile = NULL;
+	const char * BaselineFile = NULL;
+	const char * Filter = NULL;
+	double Tolerance = 0.25;
+	int Runs = 0;
+	bool JSON = false;
+
+	AppDir = ".";
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char * Arg = argv[i];
+		if (Arg[0] != '-') { SuiteFile = Arg; continue; }
+		if (Arg[1] == 0 || Arg[2] != 0) Usage(argv[0]);
+		if (Arg[1] == 'j') { JSON = true; continue; }
+
+		if (i + 1 >= argc) Usage(argv[0]);
+		const char * Val = argv[++i];
+		switch (Arg[1])
+		{
+		case 'n': Runs = atoi(Val); if (Runs <= 0) Usage(argv[0]); break;
+		case 'o': OutFile = Val; break;
+		case 'f': Filter = Val; break;
+		case 'B': BaselineFile = Val; break;
+		case 'T': Tolerance = atof(Val) / 100; break;
+		case 'd': AppDir = Val; break;
+		default: Usage(argv[0]);
+		}
+	}
+	if (SuiteFile == NULL) Usage(argv[0]);
+
+	ReadSuite(SuiteFile);
+	if (Runs) Repeat = Runs;
+
+	// only the statistics are wanted
+	CWcolView View(NULL);
+	Ctx->OutputWindow = &View;
+
+	CArray<BENCH_RESULT, BENCH_RESULT&> Results;
+	for (int q = 0; q < Queries.GetSize(); q++)
+	{
+		if (Filter && !strstr(Queries[q].File, Filter)) continue;
+		for (int r = 0; r < RuleSets.GetSize(); r++)
+			for (int c = 0; c < Configs.GetSize(); c++)
+			{
+				if (!Queries[q].RunsUnder(RuleSets[r], Configs[c])) continue;
+#ifdef IRPROP
+				if (Configs[c].GlobepsPruning)
+				{
+					fprintf(stderr, "skipping config %s: global epsilon pruning "
+						"is not supported with IRPROP\n", (LPCTSTR)Configs[c].Name);
+					continue;
+				}
+#endif
+				fprintf(stderr, "%s, %s, %s\n", (LPCTSTR)Queries[q].File,
+					(LPCTSTR)BaseName(RuleSets[r]), (LPCTSTR)Configs[c].Name);
+				RunQuery(Queries[q], RuleSets[r], Configs[c], Results);
+			}
+	}
+
+	FILE * Out = stdout;
+	if (OutFile && (Out = fopen(OutFile, "w")) == NULL)
+	{
+		fprintf(stderr, "can not create %s\n", OutFile);
+		exit(1);
+	}
+	if (JSON)
+	{
+		fprintf(Out, "[");
+		for (int r = 0; r < Results.GetSize(); r++)
+			fprintf(Out, "%s\n%s", r ? "," : "", (LPCTSTR)Results[r].DumpJSON());
+		fprintf(Out, "]\n");
+	}
+	else
+	{
+		fputs(BENCH_RESULT::CSVHeader(), Out);
+		for (int r = 0; r < Results.GetSize(); r++)
+			fputs(Results[r].DumpCSV(), Out);
+	}
+	if (Out != stdout) fclose(Out);
+
+	if (BaselineFile && CompareBaseline(BaselineFile, Tolerance, Results) > 0)
+		return 2;
+
+	return 0;
+}
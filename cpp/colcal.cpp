@@ -0,0 +1,479 @@
+/*
+colcal.cpp -  calibration of the cost model of the columbia optimizer
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  The constants of a CM file are the times of basic operations, which the
+  cost formulas of physop.cpp add up.  Those of CMS/CM were measured in
+  1997.  colcal times the same operations on this machine and writes a CM
+  file with them, in seconds:
+
+	CPU_READ		reading a cached block of a scratch file
+	IO				reading a block of the scratch file which is not
+					cached, at random (-i random) or in order (-i seq),
+					less CPU_READ
+	TOUCH_COPY		copying a tuple
+	CPU_PRED		comparing an attribute of a tuple with a constant
+	CPU_APPLY		adding an attribute of a tuple to a sum
+	CPU_COMP_MOVE	sorting 2n tuples, per compare and move: SORT costs
+					2 n log2(n) of them
+	HASH_COST		putting a tuple into a hash table
+	HASH_PROBE		looking a key up in the hash table
+	INDEX_PROBE		looking a key up in a sorted index
+
+  An operation is timed on n and on 2n tuples, the best of -r runs each,
+  and its time is the difference divided by n, which leaves out what does
+  not grow with n.  The block factors follow from the block size and the
+  tuple width: BF tuples, INDEX_BF entries of a key and a row id, and
+  BIT_BF bits in a block.
+
+  The cache of the scratch file is dropped with posix_fadvise(), which
+  some file systems (tmpfs) ignore; colcal warns when the reads it takes
+  for uncached are not slower than the cached ones.  With -m the constants
+  are scaled so that IO is that of the given CM file, so the costs keep
+  the magnitude of its costs, and only the ratios of the constants change.
+*/
+
+#include "stdafx.h"
+#include "cm.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#define INDEX_ENTRY	8		// bytes of an index entry, a key and a row id
+
+//=============  Random numbers  ===================
+// the same data on every run
+
+static unsigned long RandomState = 1;
+
+static unsigned int RandomInt()
+{
+	RandomState = RandomState * 1103515245UL + 12345UL;
+	return (RandomState >> 8) & 0xffffff;
+}
+
+//=============  Timing  ===================
+
+static volatile double Sink;	// the results, so that the work is done
+
+static double Seconds()
+{
+	return GetTimeMs() / 1000;
+}
+
+// the tuples the operations work on, Width bytes each, starting with a key
+// in 0 .. NumKey-1
+class TUPLES
+{
+public:
+	int		Width;
+	int		Num;
+	char *	Data;
+
+	TUPLES(int width, int num, int NumKey) : Width(width), Num(num)
+	{
+		Data = new char [(size_t)Width * Num];
+		memset(Data, 1, (size_t)Width * Num);
+		for (int i = 0; i < Num; i++) SetKey(i, RandomInt() % NumKey);
+	};
+	~TUPLES() { delete [] Data; };
+
+	inline char * Get(int i) { return Data + (size_t)i * Width; };
+	inline int Key(int i) { int k; memcpy(&k, Get(i), sizeof(int)); return k; };
+	inline void SetKey(int i, int k) { memcpy(Get(i), &k, sizeof(int)); };
+};
+
+static TUPLES * Input;	// the tuples timed
+static int NumKey;		// keys of the tuples
+
+typedef double (* BENCH)(int n);	// the seconds n operations take
+
+static double CopyBench(int n)
+{
+	char * Out = new char [(size_t)Input->Width * n];
+	double Start = Seconds();
+	for (int i = 0; i < n; i++) memcpy(Out + (size_t)i * Input->Width, Input->Get(i), Input->Width);
+	double End = Seconds();
+	Sink = Out[(size_t)Input->Width * (n - 1)];
+	delete [] Out;
+	return End - Start;
+}
+
+static double PredBench(int n)
+{
+	// half the tuples qualify, at random
+	int Count = 0;
+	double Start = Seconds();
+	for (int i = 0; i < n; i++)
+		if (Input->Key(i) < NumKey / 2) Count++;
+	double End = Seconds();
+	Sink = Count;
+	return End - Start;
+}
+
+static double ApplyBench(int n)
+{
+	double Sum = 0;
+	double Start = Seconds();
+	for (int i = 0; i < n; i++) Sum += Input->Key(i);
+	double End = Seconds();
+	Sink = Sum;
+	return End - Start;
+}
+
+static int CompareTuples(const void * a, const void * b)
+{
+	int x, y;
+	memcpy(&x, a, sizeof(int));
+	memcpy(&y, b, sizeof(int));
+	return x < y ? -1 : x > y;
+}
+
+// per compare and move, as SORT counts them
+static double SortBench(int n)
+{
+	char * Tuples = new char [(size_t)Input->Width * n];
+	memcpy(Tuples, Input->Data, (size_t)Input->Width * n);
+	double Start = Seconds();
+	qsort(Tuples, n, Input->Width, CompareTuples);
+	double End = Seconds();
+	Sink = Tuples[0];
+	delete [] Tuples;
+	return (End - Start) / (2 * log((double)n) / log(2.0));
+}
+
+static inline unsigned int HashKey(int Key)
+{
+	return (unsigned int)Key * 2654435761U;
+}
+
+// a hash table of the first n tuples, chained through Next
+static int HashBits(int n)
+{
+	int Bits = 1;
+	while ((1 << Bits) < n) Bits++;
+	return Bits;
+}
+
+static void Build(int n, int * Head, int * Next, int Bits)
+{
+	for (int b = 0; b < (1 << Bits); b++) Head[b] = -1;
+	for (int i = 0; i < n; i++)
+	{
+		unsigned int b = HashKey(Input->Key(i)) >> (32 - Bits);
+		Next[i] = Head[b];
+		Head[b] = i;
+	}
+}
+
+static double HashBench(int n)
+{
+	int Bits = HashBits(n);
+	int * Head = new int [1 << Bits];
+	int * Next = new int [n];
+	double Start = Seconds();
+	Build(n, Head, Next, Bits);
+	double End = Seconds();
+	Sink = Head[0];
+	delete [] Head;
+	delete [] Next;
+	return End - Start;
+}
+
+// n probes into a table of all the tuples
+static int * ProbeHead;
+static int * ProbeNext;
+static int ProbeBits;
+
+static double ProbeBench(int n)
+{
+	int Found = 0;
+	double Start = Seconds();
+	for (int i = 0; i < n; i++)
+	{
+		int Key = (int)((unsigned int)i * 2654435761U % NumKey);
+		for (int r = ProbeHead[HashKey(Key) >> (32 - ProbeBits)]; r >= 0; r = ProbeNext[r])
+			if (Input->Key(r) == Key) Found++;
+	}
+	double End = Seconds();
+	Sink = Found;
+	return End - Start;
+}
+
+// n probes into the sorted keys of all the tuples
+static int * Index;
+
+static double IndexBench(int n)
+{
+	int Found = 0;
+	double Start = Seconds();
+	for (int i = 0; i < n; i++)
+	{
+		int Key = (int)((unsigned int)i * 2654435761U % NumKey);
+		int Lo = 0, Hi = Input->Num;
+		while (Lo < Hi)
+		{
+			int Mid = (Lo + Hi) / 2;
+			if (Index[Mid] < Key) Lo = Mid + 1;
+			else Hi = Mid;
+		}
+		Found += Lo < Input->Num && Index[Lo] == Key;
+	}
+	double End = Seconds();
+	Sink = Found;
+	return End - Start;
+}
+
+static int CompareInts(const void * a, const void * b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+	return x < y ? -1 : x > y;
+}
+
+// the seconds of one operation: the growth from n to 2n operations, the
+// best of Repeat runs each
+static double Fit(BENCH Bench, int n, int Repeat)
+{
+	double Once = 1e30, Twice = 1e30;
+	for (int r = 0; r < Repeat; r++)
+	{
+		Once = MIN(Once, Bench(n));
+		Twice = MIN(Twice, Bench(2 * n));
+	}
+	// too fast to see the difference
+	if (Twice <= Once) return Twice / (2 * n);
+	return (Twice - Once) / n;
+}
+
+//=============  Disk  ===================
+
+class SCRATCH
+{
+public:
+	CString	Name;
+	int		fd;
+	int		Block;
+	int		NumBlock;
+	double	MB;
+	char *	Buffer;
+
+	SCRATCH(CString name, int block, double mb) : Name(name), fd(-1), Block(block),
+		NumBlock(0), MB(mb), Buffer(NULL) {};
+	~SCRATCH()
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+			unlink(Name);
+		}
+		delete [] Buffer;
+	};
+
+	// write the file, and the block size of its file system if Block is 0
+	bool Create()
+	{
+		if ((fd = open(Name, O_RDWR | O_CREAT | O_TRUNC, 0600)) < 0) return false;
+		if (Block == 0)
+		{
+			struct stat st;
+			Block = fstat(fd, &st) == 0 && st.st_blksize > 0 ? (int)st.st_blksize : 4096;
+		}
+		NumBlock = MAX(2, (int)(MB * 1024 * 1024 / Block));
+		Buffer = new char [Block];
+		for (int b = 0; b < NumBlock; b++)
+		{
+			for (int i = 0; i < Block; i++) Buffer[i] = (char)RandomInt();
+			if (write(fd, Buffer, Block) != Block) return false;
+		}
+		return fsync(fd) == 0;
+	};
+
+	void DropCache()
+	{
+#ifdef POSIX_FADV_DONTNEED
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+	};
+
+	// the seconds of reading Num blocks, in order or at random
+	double Read(int Num, bool Random)
+	{
+		double Sum = 0;
+		double Start = Seconds();
+		for (int i = 0; i < Num; i++)
+		{
+			int b = Random ? RandomInt() % NumBlock : i % NumBlock;
+			if (pread(fd, Buffer, Block, (off_t)b * Block) != Block) return -1;
+			Sum += Buffer[0];
+		}
+		double End = Seconds();
+		Sink = Sum;
+		return End - Start;
+	};
+};
+
+//=============  main  ===================
+
+static void Usage(const char * Prog)
+{
+	fprintf(stderr,
+		"usage: %s -o file [options]\n"
+		"  -o file      CM file to write\n"
+		"  -m file      CM file whose IO is kept, the others are scaled with it (default: seconds)\n"
+		"  -f file      scratch file, on the disk to calibrate for (default colcal.tmp)\n"
+		"  -s MB        size of the scratch file (default 256)\n"
+		"  -b bytes     block size (default the block size of the file system)\n"
+		"  -w bytes     tuple width (default 80)\n"
+		"  -n tuples    tuples of the CPU operations (default 1000000)\n"
+		"  -i kind      reads IO stands for: random or seq (default random)\n"
+		"  -r runs      runs of each operation, the best is kept (default 3)\n",
+		Prog);
+	exit(1);
+}
+
+int main(int argc, char * argv[])
+{
+	const char * OutFile = NULL;
+	const char * RefFile = NULL;
+	CString ScratchFile = "colcal.tmp";
+	double MB = 256;
+	int Block = 0, Width = 80, Num = 1000000, Repeat = 3;
+	CString IOKind = "random";
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char * Arg = argv[i];
+		if (Arg[0] != '-' || Arg[1] == 0 || Arg[2] != 0 || i + 1 >= argc) Usage(argv[0]);
+		const char * Value = argv[++i];
+		switch (Arg[1])
+		{
+		case 'o': OutFile = Value; break;
+		case 'm': RefFile = Value; break;
+		case 'f': ScratchFile = Value; break;
+		case 's': MB = atof(Value); break;
+		case 'b': Block = atoi(Value); break;
+		case 'w': Width = atoi(Value); break;
+		case 'n': Num = atoi(Value); break;
+		case 'i': IOKind = Value; break;
+		case 'r': Repeat = atoi(Value); break;
+		default: Usage(argv[0]);
+		}
+	}
+	if (!OutFile || MB <= 0 || Block < 0 || Width < (int)sizeof(int) || Num < 1000 ||
+		Repeat < 1 || (IOKind != "random" && IOKind != "seq"))
+		Usage(argv[0]);
+
+	double RefIO = 0;
+	if (RefFile)
+	{
+		FILE * fp = fopen(RefFile, "r");
+		if (fp == NULL)
+		{
+			fprintf(stderr, "can not open %s\n", RefFile);
+			exit(1);
+		}
+		fclose(fp);
+		RefIO = CM(RefFile).io();
+	}
+
+	// the disk
+	SCRATCH Scratch(ScratchFile, Block, MB);
+	if (!Scratch.Create())
+	{
+		fprintf(stderr, "can not write %s\n", (LPCTSTR)ScratchFile);
+		exit(1);
+	}
+	Block = Scratch.Block;
+	int Reads = MIN(Scratch.NumBlock, 4096);
+	Scratch.Read(Scratch.NumBlock, false);		// cached
+	double Cached = 1e30, Seq = 1e30, Random = 1e30;
+	for (int r = 0; r < Repeat; r++)
+	{
+		Cached = MIN(Cached, Scratch.Read(Scratch.NumBlock, false) / Scratch.NumBlock);
+		Scratch.DropCache();
+		Seq = MIN(Seq, Scratch.Read(Scratch.NumBlock, false) / Scratch.NumBlock);
+		Scratch.DropCache();
+		Random = MIN(Random, Scratch.Read(Reads, true) / Reads);
+	}
+	if (Cached < 0 || Seq < 0 || Random < 0)
+	{
+		fprintf(stderr, "can not read %s\n", (LPCTSTR)ScratchFile);
+		exit(1);
+	}
+	if (Seq < 2 * Cached || Random < 2 * Cached)
+		fprintf(stderr, "warning: %s seems to stay cached, the IO is not that of a disk\n",
+			(LPCTSTR)ScratchFile);
+
+	// the CPU, on twice Num tuples
+	NumKey = Num;
+	Input = new TUPLES(Width, 2 * Num, NumKey);
+	double TouchCopy = Fit(CopyBench, Num, Repeat);
+	double CpuPred = Fit(PredBench, Num, Repeat);
+	double CpuApply = Fit(ApplyBench, Num, Repeat);
+	double CompMove = 1e30;
+	for (int r = 0; r < Repeat; r++) CompMove = MIN(CompMove, SortBench(2 * Num) / (2 * Num));
+	double HashCost = Fit(HashBench, Num, Repeat);
+
+	ProbeBits = HashBits(Input->Num);
+	ProbeHead = new int [1 << ProbeBits];
+	ProbeNext = new int [Input->Num];
+	Build(Input->Num, ProbeHead, ProbeNext, ProbeBits);
+	double HashProbe = Fit(ProbeBench, Num, Repeat);
+	delete [] ProbeHead;
+	delete [] ProbeNext;
+
+	Index = new int [Input->Num];
+	for (int i = 0; i < Input->Num; i++) Index[i] = Input->Key(i);
+	qsort(Index, Input->Num, sizeof(int), CompareInts);
+	double IndexProbe = Fit(IndexBench, Num, Repeat);
+	delete [] Index;
+	delete Input;
+
+	double IO = MAX((IOKind == "random" ? Random : Seq) - Cached, Cached);
+	double Unit = RefIO > 0 ? IO / RefIO : 1;
+
+	FILE * fp;
+	if ((fp = fopen(OutFile, "w")) == NULL)
+	{
+		fprintf(stderr, "can not create %s\n", OutFile);
+		exit(1);
+	}
+	CString Command = "colcal";
+	for (int i = 1; i < argc; i++)
+	{
+		Command += " ";
+		if (strchr(argv[i], ' ')) Command += CString("\"") + argv[i] + "\"";
+		else Command += argv[i];
+	}
+	time_t Now = time(NULL);
+	char Date[32];
+	strftime(Date, sizeof(Date), "%Y-%m-%d", localtime(&Now));
+	fprintf(fp, "//cost model text file, calibrated on %s by\n// %s\n", Date, (LPCTSTR)Command);
+	fprintf(fp, "// reading a block of %d bytes: %g s cached, %g s in order, %g s at random\n",
+		Block, Cached, Seq, Random);
+	if (RefIO > 0) fprintf(fp, "// a cost of 1 is %g s, so that IO is that of %s\n", Unit, RefFile);
+	else fprintf(fp, "// a cost of 1 is 1 s\n");
+	fprintf(fp, "\n");
+	fprintf(fp, "CPU_READ:       %-12g// cpu cost of reading one block from the disk\n", Cached / Unit);
+	fprintf(fp, "TOUCH_COPY:     %-12g//cpu cost of copying one tuple to the next operator\n", TouchCopy / Unit);
+	fprintf(fp, "CPU_PRED:       %-12g// cpu cost of evaluating one predicate\n", CpuPred / Unit);
+	fprintf(fp, "CPU_APPLY:      %-12g// cpu cost of applying function on one attribute\n", CpuApply / Unit);
+	fprintf(fp, "CPU_COMP_MOVE:  %-12g// cpu cost of comparing and moving tuples\n", CompMove / Unit);
+	fprintf(fp, "HASH_COST:      %-12g// cpu cost of building hash table\n", HashCost / Unit);
+	fprintf(fp, "HASH_PROBE:     %-12g// cpu cost of finding hash bucket\n", HashProbe / Unit);
+	fprintf(fp, "INDEX_PROBE:    %-12g// cpu cost of finding index\n", IndexProbe / Unit);
+	fprintf(fp, "BF:             %-12d// block factor of table file\n", MAX(1, Block / Width));
+	fprintf(fp, "INDEX_BF:       %-12d// block factor of index file\n", Block / INDEX_ENTRY);
+	fprintf(fp, "IO:             %-12g// i/o cost of reading one block (%s)\n", IO / Unit,
+		(LPCTSTR)IOKind);
+	fprintf(fp, "BIT_BF:         %-12d// block factor of bit index file\n", Block * 8);
+	fclose(fp);
+
+	return 0;
+}
@@ -0,0 +1,335 @@
+/*
+colcmd.cpp -  command line driver of the columbia optimizer
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  Sets the options which the MFC front end reads from the option file and
+  the option dialog, then runs Optimizer().  Plans and statistics go to
+  stdout, as text or as JSON.
+*/
+
+#include "stdafx.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+// outside references, all defined in global.h
+extern CString SQueryFile;
+extern CString BQueryFile;
+extern CString CatFile;
+extern CString CMFile;
+extern CString RSFile;
+extern CString AppDir;
+extern double GLOBAL_EPS;
+
+void Optimizer();
+#ifndef _WIN32
+void Serve(CString SocketPath, bool JSON);
+#endif
+
+static void Usage(const char * Prog)
+{
+	fprintf(stderr,
+		"usage: %s -c catalog -m cm -r ruleset (-q query | -b batch) [options]\n"
+		"       %s -c catalog -m cm -r ruleset -S socket [-j] [-e eps] [-P] [-C] [-H ...] [-G ...] [-M mb]\n"
+		"       %s -R socket -q query\n"
+		"  -c file      catalog file\n"
+		"  -m file      cost model file\n"
+		"  -r file      rule set file\n"
+		"  -q file      optimize the single query in file\n"
+		"  -b file      optimize the batch of queries in file\n"
+		"  -d dir       directory for colout.txt and script.cove (default .)\n"
+		"  -e eps       global epsilon pruning with epsilon eps\n"
+		"  -j           print the plans and statistics as JSON, each plan also\n"
+		"               as a tree\n"
+		"  -p file      write the optimal plans as trees to file, in binary\n"
+		"  -s           one line per query in batch mode\n"
+		"  -J n         optimize n queries of a batch at once (not PiggyBack\n"
+		"               sequences, nor with a trace)\n"
+		"  -T           print the time spent in each task and phase\n"
+		"  -P           no group pruning (implies -C)\n"
+		"  -C           no cucard pruning\n"
+		"  -B bounds    the lower bounds of the groups, of fetch, scan, join and\n"
+		"               winner (default scan,winner, fetch alone is the\n"
+		"               original bound)\n"
+		"  -k n         keep the n cheapest plans of each group, and print the n\n"
+		"               cheapest plans of the query (default 1)\n"
+		"  -D           with -k, only the cheapest plan of each join order\n"
+		"  -X scale     run the printed plans over tables made up from the\n"
+		"               catalog, scale of their cards, and print the rows and\n"
+		"               the time of each operator\n"
+		"  -H grp,win,impr  halt when the improvement is small\n"
+		"  -G tables,mexprs  keep the joins in a greedy order when they join\n"
+		"               tables tables or more, or when the search space grows\n"
+		"               past mexprs M_EXPRs, 0 for never (default 15,2000000)\n"
+		"  -M mb        the search space of a query may take mb megabytes, the\n"
+		"               joins are kept in a greedy order over it, 0 for no\n"
+		"               budget (default 512)\n"
+		"  -F file      near the budget, spill the groups no task is using to\n"
+		"               file.pid, also in PiggyBack sequences\n"
+		"  -L file      start each query from the search space in the snapshot\n"
+		"               file, if it was made with the same catalog, cost model,\n"
+		"               rule set and pruning options\n"
+		"  -W file      write the search space of the last query, or PiggyBack\n"
+		"               sequence, to the snapshot file (not from the -J workers)\n"
+		"  -w file      cost the search space of each query again with each\n"
+		"               change in file, a constant of the cost model or the card\n"
+		"               of a collection, and print the plan found with it\n"
+		"  -a file      try the candidate indexes in file in the search space of\n"
+		"               each query, and advise those which lower the cost of the\n"
+		"               batch most within the storage budget of file\n"
+		"  -t what      trace to: file, window, cove, ssp, open, final,\n"
+		"               binary (trace.bin, decoded by coltrace)\n"
+		"  -S socket    serve the queries sent to the Unix domain socket, keeping\n"
+		"               the catalog, cost model and rule set loaded\n"
+		"  -R socket    send the query to the server at socket, print the reply\n",
+		Prog, Prog, Prog);
+	exit(1);
+}
+
+#ifndef _WIN32
+// Send the query in QueryFile to the server listening on Socket, see
+// Serve(), and copy its reply to stdout
+static int Request(const char * Socket, const char * QueryFile)
+{
+	FILE * fp = fopen(QueryFile, "r");
+	if (fp == NULL) { fprintf(stderr, "can not open %s\n", QueryFile); return 1; }
+
+	struct sockaddr_un Addr;
+	memset(&Addr, 0, sizeof(Addr));
+	Addr.sun_family = AF_UNIX;
+	strncpy(Addr.sun_path, Socket, sizeof(Addr.sun_path) - 1);
+	int Conn = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (Conn < 0 || connect(Conn, (struct sockaddr *)&Addr, sizeof(Addr)) != 0)
+	{
+		fprintf(stderr, "can not connect to the server at %s\n", Socket);
+		return 1;
+	}
+
+	char Buf[4096];
+	size_t n;
+	while ((n = fread(Buf, 1, sizeof(Buf), fp)) > 0)
+		if (write(Conn, Buf, n) != (ssize_t)n) return 1;
+	fclose(fp);
+	shutdown(Conn, SHUT_WR);
+
+	ssize_t r;
+	while ((r = read(Conn, Buf, sizeof(Buf))) > 0)
+		fwrite(Buf, 1, r, stdout);
+	close(Conn);
+	return 0;
+}
+#endif
+
+int main(int argc, char * argv[])
+{
+	bool JSON = false;
+	bool Timers = false;
+	bool Batch = false;
+	CString QueryFile;
+	CString ServerSocket;	// -S, serve on it
+	CString RequestSocket;	// -R, send the query to it
+	CString PlanFile;		// -p, write the plans to it
+
+	AppDir = ".";
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char * Arg = argv[i];
+		if (Arg[0] != '-' || Arg[1] == 0 || Arg[2] != 0) Usage(argv[0]);
+
+		// options without a value
+		switch (Arg[1])
+		{
+		case 'j': JSON = true; continue;
+		case 's': SingleLineBatch = true; continue;
+		case 'T': Timers = true; continue;
+		case 'P': Pruning = false; CuCardPruning = false; continue;
+		case 'C': CuCardPruning = false; continue;
+		case 'D': DistinctJoins = true; continue;
+		}
+
+		if (i + 1 >= argc) Usage(argv[0]);
+		const char * Value = argv[++i];
+		switch (Arg[1])
+		{
+		case 'c': CatFile = Value; break;
+		case 'm': CMFile = Value; break;
+		case 'r': RSFile = Value; break;
+		case 'q': QueryFile = Value; Batch = false; break;
+		case 'b': QueryFile = Value; Batch = true; break;
+		case 'd': AppDir = Value; break;
+		case 'p': PlanFile = Value; break;
+		case 'S': ServerSocket = Value; break;
+		case 'R': RequestSocket = Value; break;
+		case 'J':
+			Jobs = atoi(Value);
+			if (Jobs < 1) Usage(argv[0]);
+			break;
+		case 'e':
+#ifdef IRPROP
+			fprintf(stderr, "global epsilon pruning is not supported with IRPROP\n");
+			exit(1);
+#endif
+			Ctx->GlobepsPruning = true;
+			GLOBAL_EPS = atof(Value);
+			if (GLOBAL_EPS <= 0) Usage(argv[0]);
+			break;
+		case 'H':
+			Halt = true;
+			if (sscanf(Value, "%d,%d,%d", &HaltGrpSize, &HaltWinSize, &HaltImpr) != 3)
+				Usage(argv[0]);
+			break;
+		case 'G':
+			if (sscanf(Value, "%d,%d", &FallbackTables, &FallbackMExprs) != 2)
+				Usage(argv[0]);
+			break;
+		case 'M':
+			MemoryBudget = atoi(Value);
+			if (MemoryBudget < 0) Usage(argv[0]);
+			break;
+		case 'B':
+			LowerBounds = Value;
+			break;
+		case 'k':
+#ifdef IRPROP
+			fprintf(stderr, "keeping several plans is not supported with IRPROP\n");
+			exit(1);
+#endif
+			TopPlans = atoi(Value);
+			if (TopPlans < 1) Usage(argv[0]);
+			break;
+		case 'X':
+#ifdef IRPROP
+			fprintf(stderr, "running the plans is not supported with IRPROP\n");
+			exit(1);
+#endif
+			ExecScale = atof(Value);
+			if (ExecScale <= 0) Usage(argv[0]);
+			break;
+		case 'F':
+			SpillFile = Value;
+			break;
+		case 'L':
+			SnapshotIn = Value;
+			break;
+		case 'W':
+			SnapshotOut = Value;
+			break;
+		case 'w':
+			WhatIfFile = Value;
+			break;
+		case 'a':
+			AdvisorFile = Value;
+			break;
+		case 't':
+			if (strcmp(Value, "file") == 0) Ctx->FileTrace = true;
+			else if (strcmp(Value, "window") == 0) Ctx->WindowTrace = true;
+			else if (strcmp(Value, "cove") == 0) Ctx->COVETrace = true;
+			else if (strcmp(Value, "binary") == 0) Ctx->BinaryTrace = true;
+			else if (strcmp(Value, "ssp") == 0) Ctx->TraceSSP = true;
+			else if (strcmp(Value, "open") == 0) Ctx->TraceOPEN = true;
+			else if (strcmp(Value, "final") == 0) Ctx->TraceFinalSSP = true;
+			else Usage(argv[0]);
+			break;
+		default:
+			Usage(argv[0]);
+		}
+	}
+
+	KeepPlans = JSON || !PlanFile.IsEmpty();
+	// the global epsilon bound is found with the cost model as it is
+	if (!WhatIfFile.IsEmpty() && Ctx->GlobepsPruning)
+	{
+		fprintf(stderr, "costing again with changes is not supported with global epsilon pruning\n");
+		exit(1);
+	}
+	if (!AdvisorFile.IsEmpty() && Ctx->GlobepsPruning)
+	{
+		fprintf(stderr, "the index advisor is not supported with global epsilon pruning\n");
+		exit(1);
+	}
+
+#ifndef _WIN32
+	if (!RequestSocket.IsEmpty())
+	{
+		if (QueryFile.IsEmpty() || Batch) Usage(argv[0]);
+		return Request(RequestSocket, QueryFile);
+	}
+	if (!ServerSocket.IsEmpty())
+	{
+		// the server traces nothing and optimizes one query at a time
+		if (!QueryFile.IsEmpty() || Ctx->FileTrace || Ctx->COVETrace || Ctx->BinaryTrace ||
+			Ctx->WindowTrace || Ctx->TraceSSP || Ctx->TraceOPEN || Ctx->TraceFinalSSP)
+			Usage(argv[0]);
+		CWcolView View(stdout);
+		Ctx->OutputWindow = &View;
+		Serve(ServerSocket, JSON);
+	}
+#endif
+
+	if (QueryFile.IsEmpty()) Usage(argv[0]);
+	if (Batch)
+	{
+		RadioVal = 0;
+		BQueryFile = QueryFile;
+	}
+	else
+	{
+		RadioVal = 1;
+		SQueryFile = QueryFile;
+	}
+
+	// In JSON mode the usual output is not wanted, only the statistics
+	CWcolView View(JSON ? NULL : stdout);
+	Ctx->OutputWindow = &View;
+
+	Optimizer();
+
+	// for each query its number, and the size of its plan, then the plan as
+	// PLAN::Store() writes it
+	if (!PlanFile.IsEmpty())
+	{
+		FILE * fp = fopen(PlanFile, "wb");
+		if (fp == NULL)
+		{
+			fprintf(stderr, "can not create %s\n", (LPCTSTR)PlanFile);
+			return 1;
+		}
+		for (int q = 0; q < QueryStats.GetSize(); q++)
+		{
+			int Size = QueryStats[q].PlanData.GetLength();
+			fwrite(&QueryStats[q].QueryNo, sizeof(int), 1, fp);
+			fwrite(&Size, sizeof(int), 1, fp);
+			fwrite((LPCTSTR)QueryStats[q].PlanData, 1, Size, fp);
+		}
+		fclose(fp);
+	}
+
+	if (JSON)
+	{
+		printf("[");
+		for (int q = 0; q < QueryStats.GetSize(); q++)
+			printf("%s\n%s", q ? "," : "", (LPCTSTR)QueryStats[q].DumpJSON());
+		printf("]\n");
+	}
+	else if (Timers)
+	{
+		for (int q = 0; q < QueryStats.GetSize(); q++)
+		{
+			printf("Time of query %d:\n", QueryStats[q].QueryNo);
+			for (int t = 0; t < TIMER_NUM; t++)
+				printf("  %-12s %10.3f ms\n", (LPCTSTR)Ctx->TimerStat[t].Name,
+					QueryStats[q].TimerMs[t]);
+		}
+	}
+
+	return 0;
+}
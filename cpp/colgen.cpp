@@ -0,0 +1,458 @@
+/*
+colgen.cpp -  workload generator of the columbia optimizer
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  Writes a catalog and a matching query file for a join graph of a given
+  shape, so that the optimizer can be measured on join graphs which are
+  larger than the hand written Chain and Star queries, or shaped
+  differently.
+
+  The tables are named T1, T2, ...  An edge of the join graph between Ti
+  and Tj is either
+	a foreign key join		Ti.Fj = Tj.K, where Ti.Fj references the
+							candidate key Tj.K, or
+	a plain join			Ti.Ji_j = Tj.Ji_j
+  The lower numbered table of an edge is the referencing one, and gets
+  the larger cardinality when there are foreign keys.  Shapes are
+	chain		T1 - T2 - ... - Tn
+	cycle		a chain with an edge Tn - T1
+	star		T1 joined with each of the others
+	snowflake	a tree in which every table joins -k others further out
+	clique		every table joined with every other table
+	random		a random spanning tree plus each other pair with
+				probability -p
+
+  A query joins a connected part of the graph: the tables met first by a
+  breadth first walk from some table, as a left deep tree of EQJOINs in
+  the order of the walk, with all edges to the tables joined before.  With
+  more than one query the query file is a batch file in the format main.cpp
+  reads (NumOfQuery:, Query:).
+*/
+
+#include "stdafx.h"
+
+#include <algorithm>
+
+#define MAXLINE 200		// the optimizer reads lines of up to 255 characters
+
+// an edge of the join graph
+class GRAPH_EDGE
+{
+public:
+	int		From;		// referencing table, the lower numbered one
+	int		To;
+	bool	FK;			// From.F<To> references To.K
+
+	GRAPH_EDGE() : From(0), To(0), FK(false) {};
+	GRAPH_EDGE(int from, int to, bool fk) : From(from), To(to), FK(fk) {};
+};
+
+// a join graph with the catalog information of its tables
+class JOIN_GRAPH
+{
+public:
+	int		NumTable;
+	CArray<double, double>				Card;		// Card[t] of table t, 0 based
+	CArray<GRAPH_EDGE, GRAPH_EDGE&>		Edges;
+
+	JOIN_GRAPH(int n) : NumTable(n) { Card.SetSize(n); };
+
+	// the attribute of table t on edge e
+	CString AttName(GRAPH_EDGE & Edge, int t)
+	{
+		CString Name;
+		if (Edge.FK && t == Edge.To) Name = "K";
+		else if (Edge.FK) Name.Format("F%d", Edge.To + 1);
+		else Name.Format("J%d_%d", Edge.From + 1, Edge.To + 1);
+		return Name;
+	};
+
+	// is table t referenced by a foreign key?
+	bool HasKey(int t)
+	{
+		for (int e = 0; e < Edges.GetSize(); e++)
+			if (Edges[e].FK && Edges[e].To == t) return true;
+		return false;
+	};
+
+	// tables in the order of a breadth first walk from Start, the
+	// neighbors of a table in the order of Shuffle
+	void Walk(int Start, CArray<int, int> & Shuffle, CArray<int, int> & Order);
+
+	void WriteCatalog(FILE * fp, int IndexPercent);
+	void WriteQuery(FILE * fp, CArray<int, int> & Order, int Size);
+};
+
+//=============  Random numbers  ===================
+// The C library generators differ between platforms; this one gives the
+// same workload everywhere for the same seed.
+
+static unsigned long RandomState = 1;
+
+static double Random()		// uniform in [0,1)
+{
+	RandomState = RandomState * 1103515245UL + 12345UL;
+	return ((RandomState >> 8) & 0xffffff) / (double)0x1000000;
+}
+
+static int RandomInt(int n)		// uniform in 0 .. n-1
+{
+	return (int)(Random() * n);
+}
+
+//=============  JOIN_GRAPH methods  ===================
+
+void JOIN_GRAPH::Walk(int Start, CArray<int, int> & Shuffle, CArray<int, int> & Order)
+{
+	CArray<BOOL, BOOL> Seen;
+	Seen.SetSize(NumTable);
+	int t;
+	for (t = 0; t < NumTable; t++) Seen[t] = FALSE;
+
+	Order.RemoveAll();
+	Order.Add(Start);
+	Seen[Start] = TRUE;
+	for (int Next = 0; Next < Order.GetSize(); Next++)
+	{
+		int From = Order[Next];
+		for (int s = 0; s < NumTable; s++)
+		{
+			t = Shuffle[s];
+			if (Seen[t]) continue;
+			for (int e = 0; e < Edges.GetSize(); e++)
+				if ((Edges[e].From == From && Edges[e].To == t) ||
+					(Edges[e].To == From && Edges[e].From == t))
+				{
+					Order.Add(t);
+					Seen[t] = TRUE;
+					break;
+				}
+		}
+	}
+}
+
+void JOIN_GRAPH::WriteCatalog(FILE * fp, int IndexPercent)
+{
+	for (int t = 0; t < NumTable; t++)
+	{
+		// the attributes: the key, if referenced, and one per edge
+		CArray<CString, CString&> Atts;
+		CArray<double, double> UCards;
+		CString Name;
+		if (HasKey(t))
+		{
+			Name = "K";
+			Atts.Add(Name);
+			UCards.Add(Card[t]);
+		}
+		for (int e = 0; e < Edges.GetSize(); e++)
+		{
+			GRAPH_EDGE & Edge = Edges[e];
+			if (Edge.From != t && Edge.To != t) continue;
+			if (Edge.FK && Edge.To == t) continue;		// that is K
+			Name = AttName(Edge, t);
+			Atts.Add(Name);
+			// a foreign key has at most the values of the key it references
+			int Other = (Edge.From == t) ? Edge.To : Edge.From;
+			UCards.Add(MIN(Card[t], Card[Other]));
+		}
+
+		fprintf(fp, "RelName: T%d\n", t + 1);
+		fprintf(fp, "Card: %.0f\n", Card[t]);
+		fprintf(fp, "UCard: %.0f\n", Card[t]);
+		fprintf(fp, "Width: 0.01\n");
+		fprintf(fp, "Order: any\n");
+		fprintf(fp, "OrderKey: ()\n");
+		fprintf(fp, "CandidateKey: (%s)\n", HasKey(t) ? "K" : "");
+		fprintf(fp, "NumOfAttr: %d\n", Atts.GetSize());
+		fprintf(fp, "//Name(S)   Type(E)     UCard(D)    Max(D)  Min(D)\n");
+		int a;
+		for (a = 0; a < Atts.GetSize(); a++)
+			fprintf(fp, "%-12s real_t      %-11.0f %-7.0f 0\n",
+				(LPCTSTR)Atts[a], UCards[a], UCards[a]);
+
+		CArray<int, int> Index;
+		for (a = 0; a < Atts.GetSize(); a++)
+			if (RandomInt(100) < IndexPercent) Index.Add(a);
+		if (Index.GetSize() > 0)
+		{
+			fprintf(fp, "NumofIndex: %d\n", Index.GetSize());
+			fprintf(fp, "//IndexName(S)          Attribute (K)       Order (E)  Clustered(F/T)\n");
+			for (int i = 0; i < Index.GetSize(); i++)
+			{
+				Name.Format("T%d_%s", t + 1, (LPCTSTR)Atts[Index[i]]);
+				fprintf(fp, "%-23s (%s)%*s btree      F\n", (LPCTSTR)Name,
+					(LPCTSTR)Atts[Index[i]], MAX(1, 18 - Atts[Index[i]].GetLength()), "");
+			}
+		}
+
+		int NumFK = 0;
+		for (int e = 0; e < Edges.GetSize(); e++)
+			if (Edges[e].FK && Edges[e].From == t) NumFK++;
+		if (NumFK > 0)
+		{
+			fprintf(fp, "NumofForeignKey: %d\n", NumFK);
+			fprintf(fp, "//attr          reference to\n");
+			for (int e = 0; e < Edges.GetSize(); e++)
+				if (Edges[e].FK && Edges[e].From == t)
+				{
+					Name = AttName(Edges[e], t);
+					fprintf(fp, "(%s)%*s (T%d.K)\n", (LPCTSTR)Name,
+						MAX(1, 13 - Name.GetLength()), "", Edges[e].To + 1);
+				}
+		}
+		fprintf(fp, "\n");
+	}
+}
+
+// write the keys as <T.A,T.B> or T.A, breaking the line when it gets long
+static void WriteKeys(FILE * fp, CArray<CString, CString&> & Keys, int & Column)
+{
+	if (Keys.GetSize() > 1) Column += fprintf(fp, "<");
+	for (int k = 0; k < Keys.GetSize(); k++)
+	{
+		if (k > 0) Column += fprintf(fp, ",");
+		if (Column + Keys[k].GetLength() > MAXLINE)
+		{
+			fprintf(fp, "\n");
+			Column = 0;
+		}
+		Column += fprintf(fp, "%s", (LPCTSTR)Keys[k]);
+	}
+	if (Keys.GetSize() > 1) Column += fprintf(fp, ">");
+}
+
+// the first Size tables of Order, joined in that order
+void JOIN_GRAPH::WriteQuery(FILE * fp, CArray<int, int> & Order, int Size)
+{
+	CArray<BOOL, BOOL> Joined;
+	Joined.SetSize(NumTable);
+	int t;
+	for (t = 0; t < NumTable; t++) Joined[t] = FALSE;
+	for (t = 0; t < Size; t++) Joined[Order[t]] = TRUE;
+
+	// the top join is the last table, written first
+	int Depth;
+	for (Depth = 0; Depth < Size - 1; Depth++)
+	{
+		int Right = Order[Size - 1 - Depth];
+		Joined[Right] = FALSE;
+
+		CArray<CString, CString&> LeftKeys, RightKeys;
+		for (int e = 0; e < Edges.GetSize(); e++)
+		{
+			GRAPH_EDGE & Edge = Edges[e];
+			int Left;
+			if (Edge.From == Right) Left = Edge.To;
+			else if (Edge.To == Right) Left = Edge.From;
+			else continue;
+			if (!Joined[Left]) continue;
+
+			// The parser keeps the keys of a join in a KEYS_SET, so both
+			// sides must be free of duplicates.  Tables which reference the
+			// same key of Right get only the first of these edges.
+			CString LeftKey, RightKey;
+			LeftKey.Format("T%d.%s", Left + 1, (LPCTSTR)AttName(Edge, Left));
+			RightKey.Format("T%d.%s", Right + 1, (LPCTSTR)AttName(Edge, Right));
+			int k;
+			for (k = 0; k < LeftKeys.GetSize(); k++)
+				if (LeftKeys[k] == LeftKey || RightKeys[k] == RightKey) break;
+			if (k < LeftKeys.GetSize()) continue;
+			LeftKeys.Add(LeftKey);
+			RightKeys.Add(RightKey);
+		}
+
+		int Column = fprintf(fp, "%*s(EQJOIN(", MIN(2 * Depth, 40), "");
+		WriteKeys(fp, LeftKeys, Column);
+		Column += fprintf(fp, ",");
+		WriteKeys(fp, RightKeys, Column);
+		fprintf(fp, "),\n");
+	}
+
+	fprintf(fp, "%*sGET(\"T%d\")", MIN(2 * Depth, 40), "", Order[0] + 1);
+	while (--Depth >= 0)
+		fprintf(fp, ",\n%*sGET(\"T%d\")\n%*s)", MIN(2 * Depth + 2, 40), "",
+			Order[Size - 1 - Depth] + 1, MIN(2 * Depth, 40), "");
+	fprintf(fp, "\n");
+}
+
+//=============  main  ===================
+
+static void Usage(const char * Prog)
+{
+	fprintf(stderr,
+		"usage: %s -t shape -n tables -c catalog -o query [options]\n"
+		"  -t shape     chain, cycle, star, snowflake, clique or random\n"
+		"  -n tables    number of tables of the graph and of the largest query\n"
+		"  -c file      catalog to write\n"
+		"  -o file      query file to write, a batch file if there is more than one query\n"
+		"  -m tables    write queries of -m to -n tables (default -n)\n"
+		"  -r count     queries of each size, walking from a random table (default 1)\n"
+		"  -k fanout    tables joined with each table of a snowflake (default 3)\n"
+		"  -p percent   probability of an edge outside the spanning tree of random (default 10)\n"
+		"  -C min,max   range of the table cardinalities (default 1000,1000000)\n"
+		"  -D dist      distribution of the cardinalities: uniform, log or zipf (default log)\n"
+		"  -F percent   foreign key joins among the edges (default 0)\n"
+		"  -i percent   indexed attributes (default 50)\n"
+		"  -s seed      seed of the random numbers (default 1)\n",
+		Prog);
+	exit(1);
+}
+
+int main(int argc, char * argv[])
+{
+	CString Shape;
+	const char * CatalogFile = NULL;
+	const char * QueryFile = NULL;
+	int NumTable = 0, MinTable = 0, Repeat = 1, Fanout = 3, ExtraPercent = 10;
+	double MinCard = 1000, MaxCard = 1000000;
+	CString Dist = "log";
+	int FKPercent = 0, IndexPercent = 50;
+	unsigned long Seed = 1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char * Arg = argv[i];
+		if (Arg[0] != '-' || Arg[1] == 0 || Arg[2] != 0 || i + 1 >= argc) Usage(argv[0]);
+		const char * Value = argv[++i];
+		switch (Arg[1])
+		{
+		case 't': Shape = Value; break;
+		case 'n': NumTable = atoi(Value); break;
+		case 'c': CatalogFile = Value; break;
+		case 'o': QueryFile = Value; break;
+		case 'm': MinTable = atoi(Value); break;
+		case 'r': Repeat = atoi(Value); break;
+		case 'k': Fanout = atoi(Value); break;
+		case 'p': ExtraPercent = atoi(Value); break;
+		case 'C':
+			if (sscanf(Value, "%lf,%lf", &MinCard, &MaxCard) != 2) Usage(argv[0]);
+			break;
+		case 'D': Dist = Value; break;
+		case 'F': FKPercent = atoi(Value); break;
+		case 'i': IndexPercent = atoi(Value); break;
+		case 's': Seed = strtoul(Value, NULL, 10); break;
+		default: Usage(argv[0]);
+		}
+	}
+	if (MinTable == 0) MinTable = NumTable;
+	if (NumTable < 1 || MinTable < 1 || MinTable > NumTable || Repeat < 1 || Fanout < 1 ||
+		MinCard < 1 || MaxCard < MinCard || !CatalogFile || !QueryFile)
+		Usage(argv[0]);
+	if (Dist != "uniform" && Dist != "log" && Dist != "zipf") Usage(argv[0]);
+	RandomState = Seed;
+
+	// the edges, From < To
+	JOIN_GRAPH Graph(NumTable);
+	int t, u;
+	for (t = 1; t < NumTable; t++)
+	{
+		GRAPH_EDGE Edge(0, t, false);
+		if (Shape == "chain" || Shape == "cycle") Edge.From = t - 1;
+		else if (Shape == "star") Edge.From = 0;
+		else if (Shape == "snowflake") Edge.From = (t - 1) / Fanout;
+		else if (Shape == "random") Edge.From = RandomInt(t);
+		else if (Shape == "clique") break;
+		else Usage(argv[0]);
+		Graph.Edges.Add(Edge);
+	}
+	if (Shape == "cycle" && NumTable > 2)
+	{
+		GRAPH_EDGE Edge(0, NumTable - 1, false);
+		Graph.Edges.Add(Edge);
+	}
+	if (Shape == "clique" || Shape == "random")
+		for (u = 1; u < NumTable; u++)
+			for (t = 0; t < u; t++)
+			{
+				if (Shape == "random")
+				{
+					int e;
+					for (e = 0; e < Graph.Edges.GetSize(); e++)
+						if (Graph.Edges[e].From == t && Graph.Edges[e].To == u) break;
+					if (e < Graph.Edges.GetSize() || RandomInt(100) >= ExtraPercent) continue;
+				}
+				GRAPH_EDGE Edge(t, u, false);
+				Graph.Edges.Add(Edge);
+			}
+	for (int e = 0; e < Graph.Edges.GetSize(); e++)
+		Graph.Edges[e].FK = RandomInt(100) < FKPercent;
+
+	// the cardinalities
+	for (t = 0; t < NumTable; t++)
+	{
+		double Card;
+		if (Dist == "uniform") Card = MinCard + Random() * (MaxCard - MinCard);
+		else if (Dist == "log") Card = MinCard * pow(MaxCard / MinCard, Random());
+		else Card = MAX(MinCard, MaxCard / (t + 1));		// zipf, shuffled below
+		Graph.Card[t] = floor(Card + 0.5);
+	}
+	// a referencing table should not be smaller than the table it
+	// references, and the lower numbered table of an edge references
+	if (FKPercent > 0)
+		std::sort(Graph.Card.GetData(), Graph.Card.GetData() + NumTable,
+			std::greater<double>());
+	else
+		for (t = NumTable - 1; t > 0; t--)
+			std::swap(Graph.Card[t], Graph.Card[RandomInt(t + 1)]);
+
+	FILE * fp;
+	if ((fp = fopen(CatalogFile, "w")) == NULL)
+	{
+		fprintf(stderr, "can not create %s\n", CatalogFile);
+		exit(1);
+	}
+	CString Command = "colgen";
+	for (int i = 1; i < argc; i++)
+	{
+		Command += " ";
+		if (strchr(argv[i], ' ')) Command += CString("\"") + argv[i] + "\"";
+		else Command += argv[i];
+	}
+	fprintf(fp, "// %s join graph of %d tables, %d edges, generated by\n// %s\n\n",
+		(LPCTSTR)Shape, NumTable, Graph.Edges.GetSize(), (LPCTSTR)Command);
+	Graph.WriteCatalog(fp, IndexPercent);
+	fclose(fp);
+
+	if ((fp = fopen(QueryFile, "w")) == NULL)
+	{
+		fprintf(stderr, "can not create %s\n", QueryFile);
+		exit(1);
+	}
+	fprintf(fp, "// %s queries of %d to %d tables on %s, generated by\n// %s\n",
+		(LPCTSTR)Shape, MinTable, NumTable, CatalogFile, (LPCTSTR)Command);
+	int NumQuery = (NumTable - MinTable + 1) * Repeat;
+	if (NumQuery > 1) fprintf(fp, "NumOfQuery: %d\n", NumQuery);
+
+	CArray<int, int> Shuffle, Order;
+	Shuffle.SetSize(NumTable);
+	int q = 0;
+	for (int Size = MinTable; Size <= NumTable; Size++)
+		for (int r = 0; r < Repeat; r++)
+		{
+			// the first walk of each size starts at T1 in the order of the
+			// table numbers, the others at a random table in random order
+			for (t = 0; t < NumTable; t++) Shuffle[t] = t;
+			int Start = 0;
+			if (r > 0)
+			{
+				for (t = NumTable - 1; t > 0; t--)
+					std::swap(Shuffle[t], Shuffle[RandomInt(t + 1)]);
+				Start = RandomInt(NumTable);
+			}
+			Graph.Walk(Start, Shuffle, Order);
+
+			if (NumQuery > 1) fprintf(fp, "\nQuery: %d\n", ++q);
+			fprintf(fp, "//%s query of %d tables\n", (LPCTSTR)Shape, Size);
+			Graph.WriteQuery(fp, Order, Size);
+		}
+	fclose(fp);
+
+	return 0;
+}
@@ -0,0 +1,295 @@
+/*
+coltrace.cpp -  decoder of the binary trace
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  Reads the trace.bin written with "colcmd -t binary" (see trace.h) and
+  writes the COVE script, as the optimizer writes it with COVE tracing, and
+  a text trace with one line per event.
+*/
+
+#include "stdafx.h"
+
+static void Usage(const char * Prog)
+{
+	fprintf(stderr,
+		"usage: %s [-c cove] [-o text] trace.bin\n"
+		"  -c file      write the COVE script to file\n"
+		"  -o file      write the text trace to file (default stdout,\n"
+		"               none when only -c is given)\n",
+		Prog);
+	exit(1);
+}
+
+#define MEXPR_BUCKETS 65536	// buckets of the table of mexprs, a power of 2
+
+// The decoder state: the texts, the logical properties of the groups and
+// the dumps of the mexprs by address
+class TRACE_READER
+{
+private:
+	FILE *	In;
+	FILE *	Cove;
+	FILE *	Text;
+
+	CArray<CString, CString&> Texts;
+	CArray<int, int> LogProps;		// text of the logical properties, by group
+
+	// an address may be used again by a later mexpr, the table keeps the last
+	CArray<int, int> Addresses;
+	CArray<CString, CString&> MExprs;
+	CArray<int, int> Next;
+	CArray<int, int> Buckets;
+
+	// a new group or mexpr waits for its EV_INPUTS events
+	TRACE_EVENT	Pending;
+	CArray<int, int> Inputs;
+	bool	HasPending;
+
+	CString GetText(int Id) { return (Id >= 0 && Id < Texts.GetSize()) ? Texts[Id] : CString("?"); };
+	int FindMExpr(int Address);
+	CString GetMExpr(int Address);
+	CString Cost(double Value) { COST Cost(Value); return Cost.Dump(); };
+	CString TaskDump(TRACE_EVENT & Event);
+	void ReadText(TRACE_EVENT & Event);
+	void Decode(TRACE_EVENT & Event);
+	void NewMExpr();
+
+public:
+	TRACE_READER(FILE * in, FILE * cove, FILE * text)
+		: In(in), Cove(cove), Text(text), HasPending(false)
+	{
+		Buckets.SetSize(MEXPR_BUCKETS);
+		for (int i = 0; i < MEXPR_BUCKETS; i++) Buckets[i] = -1;
+	};
+
+	void Run();
+}; // class TRACE_READER
+
+void TRACE_READER::Run()
+{
+	TRACE_EVENT Event;
+
+	while (fread(&Event, sizeof(TRACE_EVENT), 1, In) == 1)
+	{
+		if (Event.Type == EV_INPUTS)
+		{
+			for (int i = 0; i < 3 && Inputs.GetSize() < Pending.Arity; i++)
+				Inputs.Add(Event.Arg[i]);
+			continue;
+		}
+		if (HasPending) NewMExpr();
+
+		if (Event.Type == EV_TEXT) ReadText(Event);
+		else Decode(Event);
+	}
+	if (HasPending) NewMExpr();
+}
+
+int TRACE_READER::FindMExpr(int Address)
+{
+	for (int i = Buckets[lookup2(Address, 0) & (MEXPR_BUCKETS - 1)]; i != -1; i = Next[i])
+		if (Addresses[i] == Address) return i;
+	return -1;
+}
+
+CString TRACE_READER::GetMExpr(int Address)
+{
+	int i = FindMExpr(Address);
+	return i == -1 ? CString("?") : MExprs[i];
+}
+
+// the text follows its event, in whole events
+void TRACE_READER::ReadText(TRACE_EVENT & Event)
+{
+	int Length = Event.Arg[0];
+	int Slots = (Length + sizeof(TRACE_EVENT) - 1) / sizeof(TRACE_EVENT);
+	CString Text;
+
+	char * Buf = Text.GetBuffer(Slots * sizeof(TRACE_EVENT));
+	if (fread(Buf, sizeof(TRACE_EVENT), Slots, In) != (size_t)Slots)
+	{
+		fprintf(stderr, "coltrace: the trace ends inside a text\n");
+		exit(1);
+	}
+	Text.ReleaseBuffer(Length);
+
+	Texts.SetSize(Event.Text + 1);
+	Texts[Event.Text] = Text;
+}
+
+// As in GROUP::GROUP() and GROUP::NewMExpr()
+void TRACE_READER::NewMExpr()
+{
+	TRACE_EVENT & Event = Pending;
+	HasPending = false;
+
+	CString InputList, MExpr, Temp;
+	MExpr = GetText(Event.Text);
+	for (int i = 0; i < Inputs.GetSize(); i++)
+	{
+		Temp.Format(" %d", Inputs[i]);
+		InputList += Temp;
+		Temp.Format(" , %d", Inputs[i]);
+		MExpr += Temp;
+	}
+	InputList += " ";
+
+	if (Event.Type == EV_NEW_GROUP)
+	{
+		if (LogProps.GetSize() <= Event.Group) LogProps.SetSize(Event.Group + 1);
+		LogProps[Event.Group] = Event.Arg[0];
+	}
+	int LogProp = Event.Group < LogProps.GetSize() ? LogProps[Event.Group] : -1;
+
+	int i = FindMExpr(Event.MExpr);
+	if (i == -1)
+	{
+		int Bucket = lookup2(Event.MExpr, 0) & (MEXPR_BUCKETS - 1);
+		i = Addresses.Add(Event.MExpr);
+		MExprs.Add(MExpr);
+		Next.Add(Buckets[Bucket]);
+		Buckets[Bucket] = i;
+	}
+	else MExprs[i] = MExpr;
+
+	// a mexpr kept out of the group is not in the COVE script
+	if (Event.Kind) return;
+
+	if (Cove) fprintf(Cove, "%s { %d %d \" %s  \"%s} %s",
+		Event.Type == EV_NEW_GROUP ? "addGroup" : "addExp",
+		Event.Group, Event.MExpr, (LPCTSTR)GetText(Event.Text),
+		(LPCTSTR)InputList, (LPCTSTR)GetText(LogProp));
+	if (Text) fprintf(Text, "%d\tnew %s %d: %s\n", Event.TaskNo,
+		Event.Type == EV_NEW_GROUP ? "group" : "mexpr in group",
+		Event.Group, (LPCTSTR)MExpr);
+}
+
+// As in the Dump() of the tasks
+CString TRACE_READER::TaskDump(TRACE_EVENT & Event)
+{
+	CString os;
+	CString Context;
+	Context.Format("Prop: %s, UB: %s", (LPCTSTR)GetText(Event.Arg[2]), (LPCTSTR)Cost(Event.Cost));
+
+	switch (Event.Kind)
+	{
+	case TK_O_GROUP:
+		os.Format("OPT_GROUP group %d, parent task %d, %s", Event.Group, Event.Arg[1],
+			(LPCTSTR)Context);
+		break;
+	case TK_E_GROUP:
+		os.Format("E_GROUP group %d, parent task %d", Event.Group, Event.Arg[1]);
+		break;
+	case TK_O_EXPR:
+		os.Format("O_EXPR group %s, parent task %d", (LPCTSTR)GetMExpr(Event.MExpr), Event.Arg[1]);
+		break;
+	case TK_O_INPUTS:
+		os.Format("O_INPUTS expression: %s, parent task %d, %s", (LPCTSTR)GetMExpr(Event.MExpr),
+			Event.Arg[1], (LPCTSTR)Context);
+		break;
+	case TK_APPLY_RULE:
+		os.Format("APPLY_RULE rule: RULE %s , mexpr %s, parent task %d",
+			(LPCTSTR)GetText(Event.Arg[2]), (LPCTSTR)GetMExpr(Event.MExpr), Event.Arg[1]);
+		break;
+	default:
+		os.Format("unknown task %d", Event.Kind);
+	}
+	return os;
+}
+
+void TRACE_READER::Decode(TRACE_EVENT & Event)
+{
+	switch (Event.Type)
+	{
+	case EV_QUERY:
+		if (Text) fprintf(Text, "Query: %d\n", Event.Arg[0]);
+		break;
+	case EV_NEW_GROUP:
+	case EV_NEW_MEXPR:
+		Pending = Event;
+		HasPending = true;
+		Inputs.RemoveAll();
+		for (int i = 0; i < Event.Arity && i < 2; i++) Inputs.Add(Event.Arg[i + 1]);
+		break;
+	case EV_END_INIT:
+		if (Cove) fprintf(Cove, "EndInit\r\n");
+		if (Text) fprintf(Text, "%d\tinitial search space complete\n", Event.TaskNo);
+		break;
+	case EV_PUSH_TASK:
+		{
+			CString Task = TaskDump(Event);
+			if (Cove) fprintf(Cove, "PushTaskList {%s}\r\n", (LPCTSTR)Task);
+			if (Text) fprintf(Text, "%d\tpush %s\n", Event.TaskNo, (LPCTSTR)Task);
+		}
+		break;
+	case EV_POP_TASK:
+		if (Cove) fprintf(Cove, "PopTaskList\r\n");
+		if (Text) fprintf(Text, "%d\tpop\n", Event.TaskNo);
+		break;
+	case EV_NEW_WINNER:
+		if (Cove) fprintf(Cove, "NewWin %d \"%s\"%s  { %d %d \"%s\" %s }\r\n",
+			Event.Group, (LPCTSTR)GetText(Event.Arg[0]), (LPCTSTR)Cost(Event.Cost),
+			Event.Group, Event.MExpr, (LPCTSTR)GetMExpr(Event.MExpr),
+			Event.Kind ? "Done" : "Not Done");
+		if (Text) fprintf(Text, "%d\tnew winner of group %d for %s: %s, cost%s, %s\n",
+			Event.TaskNo, Event.Group, (LPCTSTR)GetText(Event.Arg[0]),
+			(LPCTSTR)GetMExpr(Event.MExpr), (LPCTSTR)Cost(Event.Cost),
+			Event.Kind ? "done" : "not done");
+		break;
+	case EV_FIRE_RULE:
+		if (Text) fprintf(Text, "%d\tfire %s on %s of group %d\n", Event.TaskNo,
+			(LPCTSTR)GetText(Event.Text), (LPCTSTR)GetMExpr(Event.MExpr), Event.Group);
+		break;
+	case EV_PRUNE:
+		if (Text) fprintf(Text, "%d\tprune %s of group %d, cost so far%s>= upper bound%s\n",
+			Event.TaskNo, (LPCTSTR)GetMExpr(Event.MExpr), Event.Group,
+			(LPCTSTR)Cost(Event.Cost), (LPCTSTR)Cost(Event.Bound));
+		break;
+	default:
+		fprintf(stderr, "coltrace: unknown event %d\n", Event.Type);
+		exit(1);
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	const char * CoveFile = NULL;
+	const char * TextFile = NULL;
+	const char * TraceFile = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) CoveFile = argv[++i];
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) TextFile = argv[++i];
+		else if (argv[i][0] != '-' && TraceFile == NULL) TraceFile = argv[i];
+		else Usage(argv[0]);
+	}
+	if (TraceFile == NULL) Usage(argv[0]);
+
+	FILE * In = fopen(TraceFile, "rb");
+	if (In == NULL) { fprintf(stderr, "coltrace: can not open %s\n", TraceFile); return 1; }
+
+	FILE * Cove = NULL;
+	if (CoveFile && (Cove = fopen(CoveFile, "wb")) == NULL)
+	{ fprintf(stderr, "coltrace: can not create %s\n", CoveFile); return 1; }
+
+	FILE * Text = stdout;
+	if (TextFile && (Text = fopen(TextFile, "w")) == NULL)
+	{ fprintf(stderr, "coltrace: can not create %s\n", TextFile); return 1; }
+	if (CoveFile && !TextFile) Text = NULL;
+
+	TRACE_READER Reader(In, Cove, Text);
+	Reader.Run();
+
+	fclose(In);
+	if (Cove) fclose(Cove);
+	if (Text && Text != stdout) fclose(Text);
+
+	return 0;
+}
@@ -0,0 +1,27 @@
+/*
+console.cpp -  output window of the headless optimizer
+$Revision: 1 $
+Implements the class in console.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+
+#ifndef _WIN32
+
+//##ModelId=3B0C085B03B8
+void CWcolView::Print(LPCTSTR lpszMessage)
+{
+	if (CaptureStart.GetSize()) Captured += lpszMessage;
+	if (Out == NULL) return;
+
+	for (const char * p = lpszMessage; *p; p++)
+		if (*p != '\r') putc(*p, Out);
+}
+
+#endif //_WIN32
@@ -0,0 +1,888 @@
+/*
+exec.cpp -  implementation of running the plans of a query
+$Revision: 1 $
+Implements classes in exec.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "exec.h"
+#include "topk.h"
+#include "ssp.h"
+#include "cat.h"
+#include "physop.h"
+#include "item.h"
+
+/**********  RELATION  **********/
+
+RELATION::~RELATION()
+{
+	for (int i = 0; i < Columns.GetSize(); i++) delete Columns[i];
+}
+
+int RELATION::Find(int AttId)
+{
+	for (int i = 0; i < AttIds.GetSize(); i++)
+		if (AttIds[i] == AttId) return i;
+	return -1;
+}
+
+COLUMN * RELATION::AddColumn(int AttId)
+{
+	COLUMN * Col = new COLUMN;
+	Col->SetSize(Rows);
+	AttIds.Add(AttId);
+	Columns.Add(Col);
+	return Col;
+}
+
+/**********  SORTING AND HASHING ROWS  **********/
+
+// qsort() has no argument for the columns it sorts on
+static RELATION * SortRel;
+static int * SortCols;
+static bool * SortDesc;
+static int SortSize;
+
+static int CompareRows(const void * a, const void * b)
+{
+	int x = *(const int *)a;
+	int y = *(const int *)b;
+	for (int k = 0; k < SortSize; k++)
+	{
+		double u = SortRel->Columns[SortCols[k]]->GetData()[x];
+		double v = SortRel->Columns[SortCols[k]]->GetData()[y];
+		if (u != v) return ((u < v) != SortDesc[k]) ? -1 : 1;
+	}
+	return x - y;	// keep the order of equal rows
+}
+
+// the rows of Rel, in the order of Cols
+static void SortRows(RELATION * Rel, int * Cols, bool * Desc, int Size, CArray<int, int> & Rows)
+{
+	Rows.SetSize(Rel->Rows);
+	for (int i = 0; i < Rel->Rows; i++) Rows[i] = i;
+	SortRel = Rel;
+	SortCols = Cols;
+	SortDesc = Desc;
+	SortSize = Size;
+	if (Rel->Rows > 1) qsort(Rows.GetData(), Rel->Rows, sizeof(int), CompareRows);
+}
+
+static inline unsigned int HashValue(double Value, unsigned int Hash)
+{
+	unsigned int Words[2];
+	if (Value == 0) Value = 0;	// -0 is 0
+	memcpy(Words, &Value, sizeof(Words));
+	Hash = (Hash ^ Words[0]) * 16777619;
+	Hash = (Hash ^ Words[1]) * 16777619;
+	return Hash;
+}
+
+static unsigned int HashRow(RELATION * Rel, int * Cols, int Size, int Row)
+{
+	unsigned int Hash = 2166136261u;
+	for (int k = 0; k < Size; k++)
+		Hash = HashValue(Rel->Columns[Cols[k]]->GetData()[Row], Hash);
+	return Hash ^ (Hash >> 15);
+}
+
+static inline bool EqualRows(RELATION * L, int * LCols, int LRow,
+	RELATION * R, int * RCols, int RRow, int Size)
+{
+	for (int k = 0; k < Size; k++)
+		if (L->Columns[LCols[k]]->GetData()[LRow] != R->Columns[RCols[k]]->GetData()[RRow])
+			return false;
+	return true;
+}
+
+// a power of 2 of at least 2 * Rows buckets
+static int BucketNum(int Rows)
+{
+	int Num = 16;
+	while (Num < 2 * Rows) Num *= 2;
+	return Num;
+}
+
+// the rows of Rel with equal Cols in groups: the group of each row, and the
+// first row of each group
+static void GroupRows(RELATION * Rel, int * Cols, int Size,
+	CArray<int, int> & Group, CArray<int, int> & First)
+{
+	int Num = BucketNum(Rel->Rows);
+	CArray<int, int> Head, Next;
+	Head.SetSize(Num);
+	for (int b = 0; b < Num; b++) Head[b] = -1;
+	Group.SetSize(Rel->Rows);
+	First.RemoveAll();
+
+	for (int i = 0; i < Rel->Rows; i++)
+	{
+		int b = HashRow(Rel, Cols, Size, i) & (Num - 1);
+		int g = Head[b];
+		while (g >= 0 && !EqualRows(Rel, Cols, First[g], Rel, Cols, i, Size)) g = Next[g];
+		if (g < 0)
+		{
+			g = First.Add(i);
+			Next.Add(Head[b]);
+			Head[b] = g;
+		}
+		Group[i] = g;
+	}
+}
+
+// a random number from State
+static inline unsigned int Random(unsigned int & State)
+{
+	State ^= State << 13;
+	State ^= State >> 17;
+	State ^= State << 5;
+	return State;
+}
+
+static unsigned int HashString(CString Str)
+{
+	unsigned int Hash = 2166136261u;
+	for (int i = 0; i < Str.GetLength(); i++)
+		Hash = (Hash ^ (unsigned char)Str[i]) * 16777619;
+	return Hash;
+}
+
+/**********  TABLE  **********/
+
+TABLE::TABLE(int collId, double Scale) : CollId(collId)
+{
+	COLL_PROP * CollProp = Ctx->Cat->GetCollProp(CollId);
+	INT_ARRAY * AttNames = Ctx->Cat->GetAttNames(CollId);
+	double Card = CollProp->Card > 0 ? CollProp->Card : 0;
+	int N = (int)(Card * Scale + 0.5);
+	int Small = (int)MIN(Card, EXEC_MIN_ROWS);
+	Rel.Rows = N > Small ? N : Small;
+
+	int Col;
+	for (Col = 0; Col < AttNames->GetSize(); Col++)
+	{
+		ATTR * Attr = Ctx->Cat->GetAttr((*AttNames)[Col]);
+		int Cu = Attr->CuCard > 0 ? (int)(Attr->CuCard + 0.5) : Rel.Rows;
+		if (Cu < 1) Cu = 1;
+		double Lo = Attr->Min;
+		double Hi = Attr->Max;
+		if (Hi <= Lo && Cu > 1) { Lo = 0; Hi = Cu - 1; }	// no range in the catalog
+
+		// more values than rows are scaled, on the same grid
+		int D = Cu <= Rel.Rows ? Cu : (int)(Cu * Scale + 0.5);
+		if (D > Rel.Rows) D = Rel.Rows;
+		if (D < 1) D = 1;
+		Distinct.Add(D);
+		CuCard.Add(Cu);
+		Min.Add(Lo);
+		Step.Add(Cu > 1 ? (Hi - Lo) / (Cu - 1) : 0);
+
+		COLUMN * Values = Rel.AddColumn(Attr->AttId);
+		double * Data = Values->GetData();
+		unsigned int State = CollId * 7919 + Attr->AttId * 104729 + 1;
+		for (int r = 0; r < Rel.Rows; r++) Data[r] = Value(Col, r % D);
+		for (int s = Rel.Rows - 1; s > 0; s--)
+		{
+			int t = Random(State) % (s + 1);
+			double Temp = Data[s];
+			Data[s] = Data[t];
+			Data[t] = Temp;
+		}
+	}
+
+	// a sorted table is in the order of its keys
+	if (CollProp->Order == sorted && CollProp->Keys != NULL)
+	{
+		int Size = CollProp->Keys->GetSize();
+		int * Cols = new int [Size];
+		bool * Desc = new bool [Size];
+		for (int k = 0; k < Size; k++)
+		{
+			Cols[k] = Rel.Find((*CollProp->Keys)[k]);
+			Desc[k] = k < CollProp->KeyOrder.GetSize() && CollProp->KeyOrder[k] == descending;
+		}
+		CArray<int, int> Rows;
+		SortRows(&Rel, Cols, Desc, Size, Rows);
+		for (Col = 0; Col < Rel.Columns.GetSize(); Col++)
+		{
+			COLUMN * Sorted = new COLUMN;
+			Sorted->SetSize(Rel.Rows);
+			for (int r = 0; r < Rel.Rows; r++) (*Sorted)[r] = (*Rel.Columns[Col])[Rows[r]];
+			delete Rel.Columns[Col];
+			Rel.Columns[Col] = Sorted;
+		}
+		delete [] Cols;
+		delete [] Desc;
+	}
+
+	// the indexes of the catalog, on their first key
+	INT_ARRAY * Indices = Ctx->Cat->GetIndNames(CollId);
+	for (int i = 0; Indices && i < Indices->GetSize(); i++)
+	{
+		KEYS_SET * Keys = Ctx->Cat->GetIndProp((*Indices)[i])->Keys;
+		if (Keys->GetSize() > 0 && Rel.Find((*Keys)[0]) >= 0) GetIndex(Rel.Find((*Keys)[0]));
+	}
+}
+
+TABLE::~TABLE()
+{
+	for (int i = 0; i < IndexRows.GetSize(); i++) delete [] IndexRows[i];
+}
+
+double TABLE::Value(int Col, int j)
+{
+	if (Distinct[Col] <= 1) return Min[Col];
+	double k = floor(j * (double)(CuCard[Col] - 1) / (Distinct[Col] - 1) + 0.5);
+	return Min[Col] + k * Step[Col];
+}
+
+double TABLE::StrValue(int Col, CString Str)
+{
+	return Value(Col, HashString(Str) % Distinct[Col]);
+}
+
+int * TABLE::GetIndex(int Col)
+{
+	for (int i = 0; i < IndexCol.GetSize(); i++)
+		if (IndexCol[i] == Col) return IndexRows[i];
+
+	CArray<int, int> Rows;
+	bool Desc = false;
+	SortRows(&Rel, &Col, &Desc, 1, Rows);
+	int * Index = new int [Rel.Rows + 1];
+	for (int r = 0; r < Rel.Rows; r++) Index[r] = Rows[r];
+	IndexCol.Add(Col);
+	IndexRows.Add(Index);
+	return Index;
+}
+
+/**********  PRED  **********/
+
+double PRED::Eval(int Row)
+{
+	switch (Code)
+	{
+	case PRED_ATTR:	return Data[Row];
+	case PRED_CONST: return Value;
+	case OP_AND:	return Inputs[0]->Eval(Row) != 0 && Inputs[1]->Eval(Row) != 0;
+	case OP_OR:		return Inputs[0]->Eval(Row) != 0 || Inputs[1]->Eval(Row) != 0;
+	case OP_NOT:	return Inputs[0]->Eval(Row) == 0;
+	case OP_EQ:
+	case OP_LIKE:	return Inputs[0]->Eval(Row) == Inputs[1]->Eval(Row);
+	case OP_LT:		return Inputs[0]->Eval(Row) < Inputs[1]->Eval(Row);
+	case OP_LE:		return Inputs[0]->Eval(Row) <= Inputs[1]->Eval(Row);
+	case OP_GT:		return Inputs[0]->Eval(Row) > Inputs[1]->Eval(Row);
+	case OP_GE:		return Inputs[0]->Eval(Row) >= Inputs[1]->Eval(Row);
+	case OP_NE:		return Inputs[0]->Eval(Row) != Inputs[1]->Eval(Row);
+	case OP_IN:
+		{
+			double Left = Inputs[0]->Eval(Row);
+			for (int i = 0; i < Inputs[1]->Set.GetSize(); i++)
+				if (Inputs[1]->Set[i] == Left) return 1;
+			return 0;
+		}
+	}
+	assert(false);
+	return 0;
+}
+
+/**********  EXEC  **********/
+
+EXEC::~EXEC()
+{
+	for (int i = 0; i < Tables.GetSize(); i++) delete Tables[i];
+}
+
+TABLE * EXEC::GetTable(int CollId)
+{
+	for (int i = 0; i < Tables.GetSize(); i++)
+		if (Tables[i]->CollId == CollId) return Tables[i];
+
+	TABLE * Table = new TABLE(CollId, Scale);
+	Tables.Add(Table);
+	return Table;
+}
+
+TABLE * EXEC::FindTable(int AttId, int & Col)
+{
+	for (int i = 0; i < Tables.GetSize(); i++)
+	{
+		Col = Tables[i]->Rel.Find(AttId);
+		if (Col >= 0) return Tables[i];
+	}
+	return NULL;
+}
+
+bool EXEC::TooMany(int Rows, int Cols)
+{
+	if ((double)Rows * (Cols ? Cols : 1) <= EXEC_MAX_CELLS) return false;
+	Error.Format("more than %d values in a relation", EXEC_MAX_CELLS);
+	return true;
+}
+
+PRED * EXEC::Compile(PLAN_NODE * Node, RELATION * Rel, int AttId)
+{
+	OP * Op = Node->MExpr->GetOp();
+	CString Name = Op->GetName();
+	PRED * Pred = NULL;
+	int Col;
+
+	if (Name == "ATTR_OP")
+	{
+		int Id = ((ATTR_OP *)Op)->get_value();
+		Col = Rel->Find(Id);
+		if (Col < 0)
+		{
+			Error.Format("%s is not in the input", GetAttName(Id));
+			return NULL;
+		}
+		Pred = new PRED(PRED_ATTR);
+		Pred->Data = Rel->Columns[Col]->GetData();
+	}
+	else if (Name == "INT_OP")
+	{
+		Pred = new PRED(PRED_CONST);
+		Pred->Value = ((CONST_INT_OP *)Op)->get_value();
+	}
+	else if (Name == "STR_OP" || Name == "SET_OP")
+	{
+		// a string is a value of the attribute it is compared with
+		TABLE * Table = AttId >= 0 ? FindTable(AttId, Col) : NULL;
+		CString Rest = Name == "STR_OP" ? ((CONST_STR_OP *)Op)->get_value()
+			: ((CONST_SET_OP *)Op)->get_value();
+		Pred = new PRED(PRED_CONST);
+		while (!Rest.IsEmpty())
+		{
+			int Comma = Name == "SET_OP" ? Rest.Find(',') : -1;
+			CString Str = Comma < 0 ? Rest : Rest.Left(Comma);
+			Rest = Comma < 0 ? CString("") : Rest.Mid(Comma + 1);
+			Str.TrimLeft();
+			Str.TrimRight();
+			double Value = Table ? Table->StrValue(Col, Str) : HashString(Str);
+			Pred->Value = Value;
+			Pred->Set.Add(Value);
+		}
+	}
+	else if (Name == "COMP_OP")
+	{
+		Pred = new PRED(((COMP_OP *)Op)->GetOpCode());
+		for (int i = 0; i < Node->Arity; i++)
+			if (Node->Inputs[i]->MExpr->GetOp()->GetName() == "ATTR_OP")
+				AttId = ((ATTR_OP *)Node->Inputs[i]->MExpr->GetOp())->get_value();
+		for (int j = 0; j < Node->Arity; j++)
+		{
+			Pred->Inputs[j] = Compile(Node->Inputs[j], Rel, AttId);
+			if (Pred->Inputs[j] == NULL)
+			{
+				delete Pred;
+				return NULL;
+			}
+		}
+	}
+	else if (!Op->is_item())
+	{
+		// a subquery is run, its first value is a constant, 0 without rows
+		RELATION * Sub = Run(Node);
+		if (Sub == NULL) return NULL;
+		Pred = new PRED(PRED_CONST);
+		if (Sub->Rows > 0 && Sub->Columns.GetSize() > 0) Pred->Value = (*Sub->Columns[0])[0];
+		delete Sub;
+	}
+	else Error.Format("%s can not be run", Name);
+
+	return Pred;
+}
+
+bool EXEC::Select(PLAN_NODE * Node, RELATION * Rel, CArray<int, int> & Out)
+{
+	PRED * Pred = Compile(Node, Rel);
+	if (Pred == NULL) return false;
+	for (int i = 0; i < Rel->Rows; i++)
+		if (Pred->Eval(i) != 0) Out.Add(i);
+	delete Pred;
+	return true;
+}
+
+RELATION * EXEC::Gather(PLAN_NODE * Node, RELATION * L, CArray<int, int> & LRows,
+	RELATION * R, CArray<int, int> * RRows)
+{
+	SCHEMA * Schema = ((LOG_COLL_PROP *)Ctx->Ssp->GetGroup(Node->GrpID)->get_log_prop())->Schema;
+	if (TooMany(LRows.GetSize(), Schema->GetSize())) return NULL;
+
+	RELATION * Out = new RELATION;
+	Out->Rows = LRows.GetSize();
+	for (int i = 0; i < Schema->GetSize(); i++)
+	{
+		int AttId = (*Schema)[i]->AttId;
+		RELATION * From = L;
+		int * Rows = LRows.GetData();
+		int Col = L->Find(AttId);
+		if (Col < 0 && R != NULL)
+		{
+			From = R;
+			Rows = RRows->GetData();
+			Col = R->Find(AttId);
+		}
+		if (Col < 0)
+		{
+			Error.Format("%s is not in the input", GetAttName(AttId));
+			delete Out;
+			return NULL;
+		}
+
+		double * To = Out->AddColumn(AttId)->GetData();
+		double * Values = From->Columns[Col]->GetData();
+		for (int r = 0; r < Out->Rows; r++) To[r] = Values[Rows[r]];
+	}
+	return Out;
+}
+
+bool EXEC::HashJoin(RELATION * L, int * LCols, RELATION * R, int * RCols, int Size,
+	CArray<int, int> * RSubset, CArray<int, int> & LRows, CArray<int, int> & RRows)
+{
+	// build on R, or the rows RSubset of it
+	int Build = RSubset ? RSubset->GetSize() : R->Rows;
+	int Num = BucketNum(Build);
+	CArray<int, int> Head, Next;
+	Head.SetSize(Num);
+	Next.SetSize(R->Rows);
+	int b;
+	for (b = 0; b < Num; b++) Head[b] = -1;
+	for (int i = Build - 1; i >= 0; i--)
+	{
+		int Row = RSubset ? (*RSubset)[i] : i;
+		b = HashRow(R, RCols, Size, Row) & (Num - 1);
+		Next[Row] = Head[b];
+		Head[b] = Row;
+	}
+
+	// probe with L
+	for (int l = 0; l < L->Rows; l++)
+	{
+		b = HashRow(L, LCols, Size, l) & (Num - 1);
+		for (int r = Head[b]; r >= 0; r = Next[r])
+			if (EqualRows(L, LCols, l, R, RCols, r, Size))
+			{
+				LRows.Add(l);
+				RRows.Add(r);
+			}
+		if (TooMany(LRows.GetSize(), 1)) return false;
+	}
+	return true;
+}
+
+// the columns of attributes in Rel
+static bool FindCols(RELATION * Rel, int * Atts, int Size, int * Cols, CString & Error)
+{
+	for (int k = 0; k < Size; k++)
+	{
+		Cols[k] = Rel->Find(Atts[k]);
+		if (Cols[k] < 0)
+		{
+			Error.Format("%s is not in the input", GetAttName(Atts[k]));
+			return false;
+		}
+	}
+	return true;
+}
+
+// Make the tables and the indexes an operator reads, they are not timed
+void EXEC::Prepare(PLAN_NODE * Node)
+{
+	OP * Op = Node->MExpr->GetOp();
+	CString Name = Op->GetName();
+
+	if (Name == "FILE_SCAN") GetTable(((FILE_SCAN *)Op)->GetFileId());
+	else if (Name == "BIT_JOIN") GetTable(((BIT_JOIN *)Op)->CollId);
+	else if (Name == "LOOPS_INDEX_JOIN")
+	{
+		LOOPS_INDEX_JOIN * Join = (LOOPS_INDEX_JOIN *)Op;
+		TABLE * Table = GetTable(Join->CollId);
+		int Col = Table->Rel.Find(Join->rattrs[0]);
+		if (Col >= 0) Table->GetIndex(Col);
+	}
+	else if (Name == "INDEXED_FILTER")
+	{
+		TABLE * Table = GetTable(((INDEXED_FILTER *)Op)->GetFileId());
+		KEYS_SET & FreeVars = ((LOG_ITEM_PROP *)Ctx->Ssp->GetGroup(
+			Node->Inputs[0]->GrpID)->get_log_prop())->FreeVars;
+		int Col = FreeVars.GetSize() == 1 ? Table->Rel.Find(FreeVars[0]) : -1;
+		if (Col >= 0) Table->GetIndex(Col);
+	}
+}
+
+RELATION * EXEC::Run(PLAN_NODE * Node)
+{
+	int Arity = Node->Arity;
+	RELATION ** Inputs = new RELATION * [Arity ? Arity : 1];
+	bool Done = true;
+	int i;
+
+	// the predicates are run by their operators
+	for (i = 0; i < Arity; i++)
+	{
+		Inputs[i] = NULL;
+		if (Done && !Node->Inputs[i]->MExpr->GetOp()->is_item())
+		{
+			Inputs[i] = Run(Node->Inputs[i]);
+			Done = Inputs[i] != NULL;
+		}
+	}
+
+	RELATION * Result = NULL;
+	if (Done)
+	{
+		// the subqueries of its predicates are timed by themselves
+		Prepare(Node);
+		int First = Ms.GetSize();
+		double StartMs = GetTimeMs();
+		Result = RunOp(Node, Inputs);
+		double Took = GetTimeMs() - StartMs;
+		for (i = First; i < Ms.GetSize(); i++) Took -= Ms[i];
+		Nodes.Add(Node);
+		Rows.Add(Result ? Result->Rows : -1);
+		Ms.Add(Took);
+	}
+
+	for (i = 0; i < Arity; i++) delete Inputs[i];
+	delete [] Inputs;
+	return Result;
+}
+
+RELATION * EXEC::RunOp(PLAN_NODE * Node, RELATION ** Inputs)
+{
+	OP * Op = Node->MExpr->GetOp();
+	CString Name = Op->GetName();
+	RELATION * In = Node->Arity ? Inputs[0] : NULL;
+	CArray<int, int> LRows, RRows;
+	int r;
+
+	if (Name == "FILE_SCAN")
+	{
+		TABLE * Table = GetTable(((FILE_SCAN *)Op)->GetFileId());
+		LRows.SetSize(Table->Rel.Rows);
+		for (r = 0; r < Table->Rel.Rows; r++) LRows[r] = r;
+		return Gather(Node, &Table->Rel, LRows);
+	}
+
+	if (Name == "FILTER")
+	{
+		if (!Select(Node->Inputs[1], In, LRows)) return NULL;
+		return Gather(Node, In, LRows);
+	}
+
+	if (Name == "P_PROJECT")
+	{
+		LRows.SetSize(In->Rows);
+		for (r = 0; r < In->Rows; r++) LRows[r] = r;
+		return Gather(Node, In, LRows);
+	}
+
+	if (Name == "QSORT")
+	{
+		KEYS_SET * Keys = Node->Prop->Keys;
+		int Size = Keys->GetSize();
+		int * Cols = new int [Size];
+		bool * Desc = new bool [Size];
+		int * Atts = Keys->CopyOut();
+		bool Found = FindCols(In, Atts, Size, Cols, Error);
+		for (int k = 0; k < Size; k++)
+			Desc[k] = k < Node->Prop->KeyOrder.GetSize() && Node->Prop->KeyOrder[k] == descending;
+		if (Found) SortRows(In, Cols, Desc, Size, LRows);
+		delete [] Atts;
+		delete [] Cols;
+		delete [] Desc;
+		return Found ? Gather(Node, In, LRows) : NULL;
+	}
+
+	if (Name == "HASH_DUPLICATES")
+	{
+		int * Cols = new int [In->Columns.GetSize()];
+		for (int k = 0; k < In->Columns.GetSize(); k++) Cols[k] = k;
+		CArray<int, int> Group;
+		GroupRows(In, Cols, In->Columns.GetSize(), Group, LRows);
+		delete [] Cols;
+		return Gather(Node, In, LRows);
+	}
+
+	if (Name == "P_FUNC_OP")
+	{
+		// the function is the attribute of the group the input lacks
+		P_FUNC_OP * Func = (P_FUNC_OP *)Op;
+		SCHEMA * Schema = ((LOG_COLL_PROP *)Ctx->Ssp->GetGroup(Node->GrpID)->get_log_prop())->Schema;
+		int * Cols = new int [Func->AttsSize ? Func->AttsSize : 1];
+		bool Found = FindCols(In, Func->Atts, Func->AttsSize, Cols, Error);
+		for (int i = 0; Found && i < Schema->GetSize(); i++)
+			if (In->Find((*Schema)[i]->AttId) < 0)
+			{
+				double * Sum = In->AddColumn((*Schema)[i]->AttId)->GetData();
+				for (r = 0; r < In->Rows; r++)
+				{
+					Sum[r] = 0;
+					for (int k = 0; k < Func->AttsSize; k++) Sum[r] += In->Columns[Cols[k]]->GetData()[r];
+				}
+			}
+		delete [] Cols;
+		if (!Found) return NULL;
+		LRows.SetSize(In->Rows);
+		for (r = 0; r < In->Rows; r++) LRows[r] = r;
+		return Gather(Node, In, LRows);
+	}
+
+	if (Name == "HGROUP_LIST")
+	{
+		HGROUP_LIST * GroupBy = (HGROUP_LIST *)Op;
+		int * Cols = new int [GroupBy->GbySize ? GroupBy->GbySize : 1];
+		if (!FindCols(In, GroupBy->GbyAtts, GroupBy->GbySize, Cols, Error))
+		{
+			delete [] Cols;
+			return NULL;
+		}
+		CArray<int, int> Group;
+		GroupRows(In, Cols, GroupBy->GbySize, Group, LRows);
+		delete [] Cols;
+		// without group by attributes there is one group, of no rows maybe,
+		// and no attribute is taken from its first row
+		if (GroupBy->GbySize == 0 && LRows.GetSize() == 0) LRows.Add(-1);
+
+		// the aggregates are the attributes of the group the input lacks, in
+		// the order of AggOps
+		SCHEMA * Schema = ((LOG_COLL_PROP *)Ctx->Ssp->GetGroup(Node->GrpID)->get_log_prop())->Schema;
+		RELATION Aggs;
+		Aggs.Rows = LRows.GetSize();
+		int Agg = 0;
+		for (int i = 0; i < Schema->GetSize(); i++)
+		{
+			if (In->Find((*Schema)[i]->AttId) >= 0) continue;
+			double * Sum = Aggs.AddColumn((*Schema)[i]->AttId)->GetData();
+			for (int g = 0; g < Aggs.Rows; g++) Sum[g] = 0;
+			if (Agg >= GroupBy->AggOps->GetSize()) continue;
+			AGG_OP * AggOp = (*GroupBy->AggOps)[Agg++];
+			for (int k = 0; k < AggOp->GetAttsSize(); k++)
+			{
+				int Col = In->Find(AggOp->GetAtts()[k]);
+				if (Col < 0) continue;
+				double * Values = In->Columns[Col]->GetData();
+				for (r = 0; r < In->Rows; r++) Sum[Group[r]] += Values[r];
+			}
+		}
+		RRows.SetSize(Aggs.Rows);
+		for (r = 0; r < Aggs.Rows; r++) RRows[r] = r;
+		return Gather(Node, In, LRows, &Aggs, &RRows);
+	}
+
+	if (Name == "INDEXED_FILTER")
+	{
+		// the predicate is on one attribute, each of its values in the index
+		// is tested once
+		TABLE * Table = GetTable(((INDEXED_FILTER *)Op)->GetFileId());
+		RELATION * Rel = &Table->Rel;
+		PRED * Pred = Compile(Node->Inputs[0], Rel);
+		if (Pred == NULL) return NULL;
+		KEYS_SET & FreeVars = ((LOG_ITEM_PROP *)Ctx->Ssp->GetGroup(
+			Node->Inputs[0]->GrpID)->get_log_prop())->FreeVars;
+		int Col = FreeVars.GetSize() == 1 ? Rel->Find(FreeVars[0]) : -1;
+		if (Col < 0)
+		{
+			for (r = 0; r < Rel->Rows; r++)
+				if (Pred->Eval(r) != 0) LRows.Add(r);
+		}
+		else
+		{
+			int * Index = Table->GetIndex(Col);
+			double * Values = Rel->Columns[Col]->GetData();
+			for (r = 0; r < Rel->Rows; )
+			{
+				int End = r + 1;
+				while (End < Rel->Rows && Values[Index[End]] == Values[Index[r]]) End++;
+				if (Pred->Eval(Index[r]) != 0)
+					for (; r < End; r++) LRows.Add(Index[r]);
+				r = End;
+			}
+		}
+		delete Pred;
+		return Gather(Node, Rel, LRows);
+	}
+
+	// the joins
+	int * LAtts, * RAtts, Size;
+	if (Name == "LOOPS_JOIN")
+	{ LAtts = ((LOOPS_JOIN *)Op)->lattrs; RAtts = ((LOOPS_JOIN *)Op)->rattrs; Size = ((LOOPS_JOIN *)Op)->size; }
+	else if (Name == "LOOPS_INDEX_JOIN")
+	{ LAtts = ((LOOPS_INDEX_JOIN *)Op)->lattrs; RAtts = ((LOOPS_INDEX_JOIN *)Op)->rattrs; Size = ((LOOPS_INDEX_JOIN *)Op)->size; }
+	else if (Name == "MERGE_JOIN")
+	{ LAtts = ((MERGE_JOIN *)Op)->lattrs; RAtts = ((MERGE_JOIN *)Op)->rattrs; Size = ((MERGE_JOIN *)Op)->size; }
+	else if (Name == "HASH_JOIN")
+	{ LAtts = ((HASH_JOIN *)Op)->lattrs; RAtts = ((HASH_JOIN *)Op)->rattrs; Size = ((HASH_JOIN *)Op)->size; }
+	else if (Name == "BIT_JOIN")
+	{ LAtts = ((BIT_JOIN *)Op)->lattrs; RAtts = ((BIT_JOIN *)Op)->rattrs; Size = ((BIT_JOIN *)Op)->size; }
+	else
+	{
+		Error.Format("%s can not be run", Name);
+		return NULL;
+	}
+
+	// the right input of LOOPS_INDEX_JOIN and BIT_JOIN is a table
+	TABLE * Table = NULL;
+	RELATION * R = Node->Arity > 1 ? Inputs[1] : NULL;
+	if (Name == "LOOPS_INDEX_JOIN") Table = GetTable(((LOOPS_INDEX_JOIN *)Op)->CollId);
+	if (Name == "BIT_JOIN") Table = GetTable(((BIT_JOIN *)Op)->CollId);
+	if (Table) R = &Table->Rel;
+
+	int * LCols = new int [Size ? Size : 1];
+	int * RCols = new int [Size ? Size : 1];
+	bool Found = FindCols(In, LAtts, Size, LCols, Error) && FindCols(R, RAtts, Size, RCols, Error);
+	bool Done = Found;
+
+	if (!Found) ;
+	else if (Name == "LOOPS_JOIN")
+	{
+		for (int l = 0; Done && l < In->Rows; l++)
+		{
+			for (r = 0; r < R->Rows; r++)
+				if (EqualRows(In, LCols, l, R, RCols, r, Size))
+				{
+					LRows.Add(l);
+					RRows.Add(r);
+				}
+			Done = !TooMany(LRows.GetSize(), 1);
+		}
+	}
+	else if (Name == "HASH_JOIN")
+		Done = HashJoin(In, LCols, R, RCols, Size, NULL, LRows, RRows);
+	else if (Name == "BIT_JOIN")
+	{
+		// the bit index is the rows of the table the predicate holds for
+		CArray<int, int> Bits;
+		Done = Select(Node->Inputs[1], R, Bits) &&
+			HashJoin(In, LCols, R, RCols, Size, &Bits, LRows, RRows);
+	}
+	else if (Name == "LOOPS_INDEX_JOIN")
+	{
+		// look the first attribute up in the index, test the others
+		int * Index = Table->GetIndex(RCols[0]);
+		double * Values = R->Columns[RCols[0]]->GetData();
+		double * Keys = In->Columns[LCols[0]]->GetData();
+		for (int l = 0; Done && l < In->Rows; l++)
+		{
+			int Lo = 0, Hi = R->Rows;
+			while (Lo < Hi)
+			{
+				int Mid = (Lo + Hi) / 2;
+				if (Values[Index[Mid]] < Keys[l]) Lo = Mid + 1;
+				else Hi = Mid;
+			}
+			for (; Lo < R->Rows && Values[Index[Lo]] == Keys[l]; Lo++)
+				if (EqualRows(In, LCols, l, R, RCols, Index[Lo], Size))
+				{
+					LRows.Add(l);
+					RRows.Add(Index[Lo]);
+				}
+			Done = !TooMany(LRows.GetSize(), 1);
+		}
+	}
+	else if (Name == "MERGE_JOIN")
+	{
+		// both inputs are sorted on the attributes, ascending
+		int l = 0;
+		r = 0;
+		while (Done && l < In->Rows && r < R->Rows)
+		{
+			int k;
+			double u = 0, v = 0;
+			for (k = 0; k < Size; k++)
+			{
+				u = In->Columns[LCols[k]]->GetData()[l];
+				v = R->Columns[RCols[k]]->GetData()[r];
+				if (u != v) break;
+			}
+			if (k < Size && u < v) l++;
+			else if (k < Size) r++;
+			else
+			{
+				int LEnd = l + 1, REnd = r + 1;
+				while (LEnd < In->Rows && EqualRows(In, LCols, LEnd, In, LCols, l, Size)) LEnd++;
+				while (REnd < R->Rows && EqualRows(R, RCols, REnd, R, RCols, r, Size)) REnd++;
+				for (int i = l; i < LEnd; i++)
+					for (int j = r; j < REnd; j++)
+					{
+						LRows.Add(i);
+						RRows.Add(j);
+					}
+				Done = !TooMany(LRows.GetSize(), 1);
+				l = LEnd;
+				r = REnd;
+			}
+		}
+	}
+
+	delete [] LCols;
+	delete [] RCols;
+	return Done ? Gather(Node, In, LRows, R, &RRows) : NULL;
+}
+
+void EXEC::Print(PLAN_NODE * Node, int tabs)
+{
+	OP * Op = Node->MExpr->GetOp();
+	int j;
+
+	// the predicates are not run by themselves, their subqueries are
+	if (Op->is_item())
+	{
+		for (j = 0; j < Node->Arity; j++) Print(Node->Inputs[j], tabs);
+		return;
+	}
+
+	double Local = Node->Cost;
+	for (int i = 0; i < Node->Arity; i++) Local -= Node->Inputs[i]->Cost;
+	double Card = ((LOG_COLL_PROP *)Ctx->Ssp->GetGroup(Node->GrpID)->get_log_prop())->Card;
+
+	CString os, temp;
+	os = Op->Dump();
+	if (Op->GetName() == "QSORT") os += Node->Prop->Dump();
+	temp.Format(", Cost = %.3f, Local = %.3f, Card = %.2f", Node->Cost, Local, Card * Scale);
+	os += temp;
+
+	int k = 0;
+	while (k < Nodes.GetSize() && Nodes[k] != Node) k++;
+	if (k == Nodes.GetSize()) os += ", not run";
+	else if (Rows[k] < 0) os += ", stopped";
+	else
+	{
+		temp.Format(", Rows = %d, Time = %.3f ms", Rows[k], Ms[k]);
+		os += temp;
+	}
+	os += "\r\n";
+	OUTPUTN(tabs, os);
+
+	for (j = 0; j < Node->Arity; j++) Print(Node->Inputs[j], tabs + 1);
+}
+
+void EXEC::Execute(int No, PLAN_NODE * Root)
+{
+	Nodes.RemoveAll();
+	Rows.RemoveAll();
+	Ms.RemoveAll();
+	Error.Empty();
+
+	RELATION * Result = Run(Root);
+
+	CString os;
+	os.Format("========  EXECUTED PLAN %d, Cost = %s, Scale = %g =========\r\n",
+		No, COST(Root->Cost).Dump(), Scale);
+	OUTPUT("%s", os);
+	Print(Root, 0);
+
+	double Total = 0;
+	for (int i = 0; i < Ms.GetSize(); i++) Total += Ms[i];
+	if (Result == NULL) os.Format("Stopped: %s\r\n", Error);
+	else os.Format("Rows = %d, Time = %.3f ms\r\n", Result->Rows, Total);
+	OUTPUT("%s", os);
+	delete Result;
+}
@@ -0,0 +1,401 @@
+/*
+greedy.cpp -  implementation of the greedy plan
+$Revision: 1 $
+Implements classes in greedy.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "greedy.h"
+#include "physop.h"
+
+#define NOT_COSTED -2
+
+// the cheaper of two costs, -1 is infinite
+static inline double Cheaper(double Cost1, double Cost2)
+{
+	if (Cost1 == -1) return Cost2;
+	if (Cost2 == -1) return Cost1;
+	return Cost1 < Cost2 ? Cost1 : Cost2;
+}
+
+static inline bool IsJoin(OP * Op)
+{
+	return Op->GetName().Compare("EQJOIN") == 0;
+}
+
+GREEDY::GREEDY()
+{
+	Any = new PHYS_PROP(any);
+
+	// with commute and one of the associativity rules every order of the
+	// joins can be reached from the one written
+	Reorder = (*Ctx->RuleSet)[R_EQJOIN_COMMUTE] != NULL &&
+		((*Ctx->RuleSet)[R_EQJOIN_LTOR] != NULL || (*Ctx->RuleSet)[R_EQJOIN_RTOL] != NULL);
+}
+
+GREEDY::~GREEDY()
+{
+	delete Any;
+}
+
+double GREEDY::WrittenCost()
+{
+	return RootCost(GroupCost(Ctx->Ssp->GetRootGID(), false));
+}
+
+double GREEDY::GreedyCost()
+{
+	return RootCost(GroupCost(Ctx->Ssp->GetRootGID(), Reorder));
+}
+
+// The query may require its result sorted
+double GREEDY::RootCost(double Cost)
+{
+	if (Ctx->vc[0]->GetPhysProp()->GetOrder() == any) return Cost;
+	return SortCost(Ctx->Ssp->GetGroup(Ctx->Ssp->GetRootGID())->get_log_prop(), Cost);
+}
+
+double GREEDY::GroupCost(GRP_ID GrpID, bool Greedy)
+{
+	CArray<double, double> & Cost = Costs[Greedy];
+	while (Cost.GetSize() <= GrpID) Cost.Add(NOT_COSTED);
+	if (Cost[GrpID] != NOT_COSTED) return Cost[GrpID];
+
+	M_EXPR * MExpr = Ctx->Ssp->GetGroup(GrpID)->GetFirstLogMExpr();
+	double Result = -1;
+
+	// a predicate costs its subqueries, see ITEM_OP::FindLocalCost()
+	if (MExpr->GetOp()->is_item())
+	{
+		Result = 0;
+		for (int i = MExpr->GetArity(); --i >= 0 && Result != -1; )
+		{
+			double InputCost = GroupCost(MExpr->GetInput(i), Greedy);
+			Result = InputCost == -1 ? -1 : Result + InputCost;
+		}
+	}
+	// the joins below are ordered together, see GreedyJoins()
+	else if (Greedy && IsJoin(MExpr->GetOp()))
+		Result = Cheaper(GroupCost(GrpID, false), GreedyJoins(GrpID));
+	else for (; MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		Result = Cheaper(Result, MExprCost(MExpr, Greedy));
+
+	Cost[GrpID] = Result;
+	return Result;
+}
+
+// As O_EXPR::perform() and APPLY_RULE::perform() do for the implementation
+// rules, with the root context
+double GREEDY::MExprCost(M_EXPR * MExpr, bool Greedy)
+{
+	GROUP * Group = Ctx->Ssp->GetGroup(MExpr->GetGrpID());
+	OP * Op = MExpr->GetOp();
+	double Result = -1;
+
+	for (int RuleNo = 0; RuleNo < Ctx->RuleSet->RuleCount; RuleNo++)
+	{
+		RULE * Rule = (*Ctx->RuleSet)[RuleNo];
+
+		// enforcers match any expression, their pattern is a leaf
+		if (Rule == NULL || !Rule->is_log_to_phys() ||
+			Rule->GetOriginal()->GetOp()->is_leaf()) continue;
+		if (!Rule->top_match(Op) || Rule->promise(Op, 0) <= 0) continue;
+
+		BINDERY * Bindery = new BINDERY(MExpr, Rule->GetOriginal());
+		EXPR * Before;
+		for ( ; Bindery->advance(); delete Before)
+		{
+			Before = Bindery->extract_expr();
+			if (!Rule->condition(Before, MExpr, 0)) continue;
+
+			EXPR * After = Rule->next_substitute(Before, Any);
+			PHYS_OP * PhysOp = (PHYS_OP *)After->GetOp();
+			int Arity = After->GetArity();
+			LOG_PROP ** InputProps = new LOG_PROP * [Arity + 1];
+			double * InputCosts = new double [Arity + 1];
+
+			for (int i = 0; i < Arity; i++)
+			{
+				GRP_ID InputID = ((LEAF_OP *)After->GetInput(i)->GetOp())->GetGroup();
+				GROUP * Input = Ctx->Ssp->GetGroup(InputID);
+				InputProps[i] = Input->get_log_prop();
+				InputCosts[i] = GroupCost(InputID, Greedy);
+			}
+			// a const input is not given a property, as in O_INPUTS::perform()
+			for (int i = 0; i < Arity; i++)
+			{
+				GRP_ID InputID = ((LEAF_OP *)After->GetInput(i)->GetOp())->GetGroup();
+				if (!Ctx->Ssp->GetGroup(InputID)->GetFirstLogMExpr()->GetOp()->is_const())
+					InputCosts[i] = InputCost(PhysOp, i, InputProps[i], InputCosts[i]);
+			}
+			Result = Cheaper(Result, PhysCost(PhysOp, Group->get_log_prop(), InputProps, InputCosts));
+
+			delete [] InputProps;
+			delete [] InputCosts;
+			delete After;
+		}
+		delete Bindery;
+	}
+
+	return Result;
+}
+
+double GREEDY::InputCost(PHYS_OP * Op, int InputNo, LOG_PROP * InputProp, double Cost)
+{
+	if (Cost == -1) return -1;
+
+	bool Possible;
+	PHYS_PROP * Reqd = Op->InputReqdProp(Any, InputProp, InputNo, Possible);
+	bool Sorted = Reqd != NULL && Reqd->GetOrder() != any;
+	delete Reqd;
+
+	if (!Possible) return -1;
+	if (!Sorted) return Cost;
+	return SortCost(InputProp, Cost);
+}
+
+// Sort the cheapest plan, as SORT_RULE does
+double GREEDY::SortCost(LOG_PROP * LogProp, double Cost)
+{
+	if (Cost == -1 || (*Ctx->RuleSet)[R_SORT_RULE] == NULL) return -1;
+
+	QSORT Sort;
+	COST LocalCost = Sort.FindLocalCost(LogProp, &LogProp);
+	double Result = LocalCost.GetValue() == -1 ? -1 : LocalCost.GetValue() + Cost;
+
+	return Result;
+}
+
+// The sum is taken in the order of COST::FinalCost()
+double GREEDY::PhysCost(PHYS_OP * Op, LOG_PROP * LocalProp, LOG_PROP ** InputProps,
+						double * InputCosts)
+{
+	int Arity = Op->GetArity();
+	for (int i = 0; i < Arity; i++)
+		if (InputCosts[i] == -1) return -1;
+
+	COST LocalCost = Op->FindLocalCost(LocalProp, InputProps);
+	double Result = LocalCost.GetValue();
+	if (Result == -1) return -1;
+
+	for (int i = Arity; --i >= 0; ) Result += InputCosts[i];
+	return Result;
+}
+
+void GREEDY::JoinInputs(GRP_ID GrpID, CArray<GRP_ID, GRP_ID> & Inputs,
+						CArray<int, int> & LAttrs, CArray<int, int> & RAttrs)
+{
+	M_EXPR * MExpr = Ctx->Ssp->GetGroup(GrpID)->GetFirstLogMExpr();
+	if (!IsJoin(MExpr->GetOp()))
+	{
+		Inputs.Add(GrpID);
+		return;
+	}
+
+	EQJOIN * Op = (EQJOIN *)MExpr->GetOp();
+	for (int i = 0; i < Op->size; i++)
+	{
+		LAttrs.Add(Op->lattrs[i]);
+		RAttrs.Add(Op->rattrs[i]);
+	}
+	JoinInputs(MExpr->GetInput(0), Inputs, LAttrs, RAttrs);
+	JoinInputs(MExpr->GetInput(1), Inputs, LAttrs, RAttrs);
+}
+
+// the predicates joining Left and Right, the attributes of Left first
+static int JoinKeys(LOG_PROP * Left, LOG_PROP * Right, CArray<int, int> & LAttrs,
+					CArray<int, int> & RAttrs, int * LKeys, int * RKeys)
+{
+	SCHEMA * LSchema = ((LOG_COLL_PROP *)Left)->Schema;
+	SCHEMA * RSchema = ((LOG_COLL_PROP *)Right)->Schema;
+	int Size = 0;
+
+	for (int i = 0; i < LAttrs.GetSize(); i++)
+	{
+		if (LSchema->InSchema(LAttrs[i]) && RSchema->InSchema(RAttrs[i]))
+		{
+			LKeys[Size] = LAttrs[i];
+			RKeys[Size++] = RAttrs[i];
+		}
+		else if (LSchema->InSchema(RAttrs[i]) && RSchema->InSchema(LAttrs[i]))
+		{
+			LKeys[Size] = RAttrs[i];
+			RKeys[Size++] = LAttrs[i];
+		}
+	}
+	return Size;
+}
+
+// Greedy operator ordering: join the two parts, joined by a predicate, with
+// the smallest result until one part is left.  A cartesian product is made
+// only when no two parts are joined by a predicate.
+double GREEDY::GreedyJoins(GRP_ID GrpID, EXPR ** Expr)
+{
+	CArray<GRP_ID, GRP_ID> Inputs;
+	CArray<int, int> LAttrs, RAttrs;
+	JoinInputs(GrpID, Inputs, LAttrs, RAttrs);
+	if (Inputs.GetSize() < 3) return -1;		// nothing to order
+
+	// the parts joined so far.  The properties of the joins come from
+	// Ctx->PropCache and are released at the end, those of the inputs
+	// belong to their groups.
+	CArray<LOG_PROP *, LOG_PROP *> Props;
+	CArray<double, double> PartCosts;
+	CArray<int, int> Made;
+	CArray<EXPR *, EXPR *> Exprs;
+	int i, j;
+	for (i = 0; i < Inputs.GetSize(); i++)
+	{
+		Props.Add(Ctx->Ssp->GetGroup(Inputs[i])->get_log_prop());
+		PartCosts.Add(GroupCost(Inputs[i], true));
+		Made.Add(false);
+		if (Expr != NULL) Exprs.Add(GroupExpr(Inputs[i]));
+	}
+
+	int * LKeys = new int [LAttrs.GetSize() + 1];
+	int * RKeys = new int [LAttrs.GetSize() + 1];
+
+	while (Props.GetSize() > 1)
+	{
+		int Best1 = -1, Best2 = -1, BestSize = 0;
+		LOG_PROP * BestProp = NULL;
+
+		for (i = 0; i < Props.GetSize(); i++)
+			for (j = i + 1; j < Props.GetSize(); j++)
+			{
+				int Size = JoinKeys(Props[i], Props[j], LAttrs, RAttrs, LKeys, RKeys);
+				if (BestProp != NULL && Size == 0 && BestSize > 0) continue;
+
+				EQJOIN Join(CopyArray(LKeys, Size), CopyArray(RKeys, Size), Size);
+				LOG_PROP * JoinInputs[2] = { Props[i], Props[j] };
+				LOG_PROP * Prop = Ctx->PropCache->Find(&Join, JoinInputs);
+
+				if (BestProp == NULL || (Size > 0 && BestSize == 0) ||
+					((LOG_COLL_PROP *)Prop)->Card < ((LOG_COLL_PROP *)BestProp)->Card)
+				{
+					if (BestProp != NULL) BestProp->Release();
+					BestProp = Prop;
+					Best1 = i;
+					Best2 = j;
+					BestSize = Size;
+				}
+				else Prop->Release();
+			}
+
+		JoinKeys(Props[Best1], Props[Best2], LAttrs, RAttrs, LKeys, RKeys);
+		double Cost = JoinCost(LKeys, RKeys, BestSize, BestProp, Props[Best1], PartCosts[Best1],
+			Props[Best2], PartCosts[Best2]);
+		if (Expr != NULL)
+		{
+			Exprs[Best1] = new EXPR(new EQJOIN(CopyArray(LKeys, BestSize),
+				CopyArray(RKeys, BestSize), BestSize), Exprs[Best1], Exprs[Best2]);
+			Exprs.RemoveAt(Best2);
+		}
+
+		if (Made[Best1]) Props[Best1]->Release();
+		if (Made[Best2]) Props[Best2]->Release();
+		Props[Best1] = BestProp;
+		PartCosts[Best1] = Cost;
+		Made[Best1] = true;
+		Props.RemoveAt(Best2);
+		PartCosts.RemoveAt(Best2);
+		Made.RemoveAt(Best2);
+	}
+	double Result = PartCosts[0];
+	if (Expr != NULL) *Expr = Exprs[0];
+
+	for (i = 0; i < Props.GetSize(); i++)
+		if (Made[i]) Props[i]->Release();
+	delete [] LKeys;
+	delete [] RKeys;
+
+	return Result;
+}
+
+EXPR * GREEDY::GreedyExpr()
+{
+	return GroupExpr(Ctx->Ssp->GetRootGID());
+}
+
+// The first expression of the group, as the query has it, but with its
+// joins in the greedy order
+EXPR * GREEDY::GroupExpr(GRP_ID GrpID)
+{
+	M_EXPR * MExpr = Ctx->Ssp->GetGroup(GrpID)->GetFirstLogMExpr();
+	EXPR * Expr = NULL;
+
+	if (IsJoin(MExpr->GetOp()))
+	{
+		GreedyJoins(GrpID, &Expr);
+		if (Expr != NULL) return Expr;
+	}
+
+	int Arity = MExpr->GetArity();
+	EXPR ** Inputs = Arity ? new EXPR * [Arity] : NULL;
+	for (int i = 0; i < Arity; i++)
+		Inputs[i] = GroupExpr(MExpr->GetInput(i));
+	return new EXPR(MExpr->GetOp()->Clone(), Inputs);
+}
+
+// the number of inputs of the tree of joins at Expr, 1 if Expr is not a
+// join.  Largest is the largest number of the trees in Expr.
+static int JoinTreeSize(EXPR * Expr, int & Largest)
+{
+	int Size = 0;
+	for (int i = 0; i < Expr->GetArity(); i++)
+		Size += JoinTreeSize(Expr->GetInput(i), Largest);
+
+	if (!IsJoin(Expr->GetOp())) return 1;
+	if (Size > Largest) Largest = Size;
+	return Size;
+}
+
+int GREEDY::JoinSize(EXPR * Expr)
+{
+	int Largest = 0;
+	JoinTreeSize(Expr, Largest);
+	return Largest;
+}
+
+// The join algorithms of the rule set which need no index, with either
+// input on the left, as EQJOIN_COMMUTE allows
+double GREEDY::JoinCost(int * LAttrs, int * RAttrs, int Size, LOG_PROP * LocalProp,
+						LOG_PROP * Left, double LeftCost, LOG_PROP * Right, double RightCost)
+{
+	double Result = -1;
+
+	for (int Swap = 0; Swap < 2; Swap++)
+	{
+		int * LKeys = Swap ? RAttrs : LAttrs;
+		int * RKeys = Swap ? LAttrs : RAttrs;
+		LOG_PROP * InputProps[2] = { Swap ? Right : Left, Swap ? Left : Right };
+		double Costs[2] = { Swap ? RightCost : LeftCost, Swap ? LeftCost : RightCost };
+
+		PHYS_OP * Ops[3];
+		int OpCount = 0;
+		if ((*Ctx->RuleSet)[R_EQ_TO_LOOPS] != NULL)
+			Ops[OpCount++] = new LOOPS_JOIN(CopyArray(LKeys, Size), CopyArray(RKeys, Size), Size);
+		// see the promise() of these rules
+		if (Size > 0 && (*Ctx->RuleSet)[R_EQ_TO_HASH] != NULL)
+			Ops[OpCount++] = new HASH_JOIN(CopyArray(LKeys, Size), CopyArray(RKeys, Size), Size);
+		if (Size > 0 && (*Ctx->RuleSet)[R_EQ_TO_MERGE] != NULL)
+			Ops[OpCount++] = new MERGE_JOIN(CopyArray(LKeys, Size), CopyArray(RKeys, Size), Size);
+
+		for (int k = 0; k < OpCount; k++)
+		{
+			double InputCosts[2];
+			for (int i = 0; i < 2; i++)
+				InputCosts[i] = InputCost(Ops[k], i, InputProps[i], Costs[i]);
+			Result = Cheaper(Result, PhysCost(Ops[k], LocalProp, InputProps, InputCosts));
+			delete Ops[k];
+		}
+	}
+
+	return Result;
+}
@@ -1,377 +1,564 @@
-/*	
-group.cpp -  implementation of class GROUP
-	$Revision: 12 $
-	Implements class GROUP as defined in ssp.h
-
-	Columbia Optimizer Framework
-
-	A Joint Research Project of Portland State University 
-	   and the Oregon Graduate Institute
-	Directed by Leonard Shapiro and David Maier
-	Supported by NSF Grants IRI-9610013 and IRI-9619977
-
-	
-*/
-#include "stdafx.h"
-#include "ssp.h"
-
-#ifdef _DEBUG
-	#define new DEBUG_NEW
-#endif
-
-//##ModelId=3B0C086603C7
-GROUP::GROUP(M_EXPR * MExpr)
-:GroupID(MExpr->GetGrpID()), 
-FirstLogMExpr(MExpr), LastLogMExpr(MExpr), 
-FirstPhysMExpr(NULL), LastPhysMExpr(NULL)
-{
-	if (!ForGlobalEpsPruning) ClassStat[C_GROUP].New();
-	
-	init_state();
-	
-	// find the log prop
-	int arity = MExpr->GetArity();
-	LOG_PROP ** InputProp=NULL;
-	if(arity==0)
-	{	LogProp = (MExpr->GetOp())->FindLogProp(InputProp);
-	}
-	else
-	{
-		InputProp = new LOG_PROP* [arity];
-		GROUP *Group;
-		for(int i=0; i<arity; i++)
-		{	
-			Group = Ssp->GetGroup(MExpr->GetInput(i));
-			InputProp[i] = Group->LogProp;
-		}
-		
-		LogProp = ((MExpr->GetOp())->FindLogProp(InputProp));
-		
-		delete [] InputProp;
-	}
-	
-	/* Calculate the LowerBd, which is:
-	TouchCopyCost:        
-	touchcopy() * |G| +     //From top join
-	touchcopy() * sum(cucard(Ai) i = 2, ..., n-1) +  // from other, nontop, joins
-	+ FetchCost:
-	fetchbound() * sum(cucard(Ai) i = 1, ..., n) // from leaf fetches
-	*/
-	double cost = 0;
-	if( MExpr->GetOp()->is_logical() )
-	{
-		if( MExpr->GetOp()->GetName().Compare("GET") == 0 )
-			cost = 0; //Since GET operator does not have a CopyOut cost
-		else
-			cost = TouchCopyCost( (LOG_COLL_PROP *)LogProp ) ;
-		
-		// Add in fetching cost if CuCard Pruning 
-		if(CuCardPruning)
-			cost += FetchingCost((LOG_COLL_PROP *)LogProp);
-	}
-	
-	LowerBd = new COST(cost);
-	
-	/* if the operator is EQJOIN with m tables, estimate group size
-	   is 2^m*2.5. else it is zero */
-	if ( MExpr->GetOp()->GetName().Compare("EQJOIN") == 0)
-	{
-		int NumTables = this->EstimateNumTables(MExpr);
-		EstiGrpSize = pow(2, NumTables)*2.5;
-	}
-	else
-		EstiGrpSize = 0;
-	
-	// the initial value is -1, meaning no winner has been found
-	count = -1;
-	if(COVETrace)	//New Group
-	{
-		char buffer[10]; //Holds input group ID
-		CString temp;
-		if(arity){
-			for(int i = 0; i < arity; i++){
-				(void)itoa(MExpr -> GetInput(i), buffer, 10);
-				temp = temp + " "+ buffer;
-			}
-		}
-		temp += " ";
-		
-		CString os;
-		os.Format("addGroup { %d %d \" %s  \"%s} %s",
-			
-			GroupID, int(MExpr), MExpr -> GetOp() -> Dump(),
-			temp, LogProp -> DumpCOVE()
-			);
-		
-		OutputCOVE.Write(os, os.GetLength());
-	}
-}
-
-// free up memory
-//##ModelId=3B0C086603C9
-GROUP::~GROUP()
-{
-	if (!ForGlobalEpsPruning) ClassStat[C_GROUP].Delete();
-	
-	delete LogProp;
-	delete LowerBd;
-	
-	M_EXPR * mexpr =FirstLogMExpr;
-	M_EXPR * next = mexpr;
-	while( next!=NULL )
-	{	next = mexpr->GetNextMExpr();
-		delete mexpr; 
-		mexpr = next;
-	}
-	
-	mexpr =FirstPhysMExpr;
-	next = mexpr;
-	while( next!=NULL )
-	{	next = mexpr->GetNextMExpr();
-		delete mexpr; 
-		mexpr = next;
-	}
-	
-#ifndef IRPROP
-	for(int i=0;i<Winners.GetSize();i++)
-		delete Winners[i];
-#endif
-	
-}
-
-// estimate the number of tables in EQJOIN
-//##ModelId=3B0C086701FC
-int  GROUP::EstimateNumTables(M_EXPR * MExpr)
-{
-	int table_num;
-	int total=0;
-	GROUP *Group;
-	int arity = MExpr->GetArity();
-	// if the input is EQJOIN, continue to count all the input
-	for(int i=0; i<arity; i++)
-	{	
-		Group = Ssp->GetGroup(MExpr->GetInput(i));
-		if (Group->GetFirstLogMExpr()->GetOp()->GetName().Compare("EQJOIN") == 0)
-		{
-			table_num = Group->EstimateNumTables(Group->GetFirstLogMExpr());
-		}
-		else table_num=1;
-		total += table_num;
-	}
-	return total;
-}
-
-//##ModelId=3B0C08670089
-void GROUP::NewMExpr(M_EXPR *MExpr) 
-{
-	// link to last mexpr
-	if(MExpr->GetOp()->is_logical())
-	{
-		LastLogMExpr->SetNextMExpr(MExpr);	
-		LastLogMExpr = MExpr;
-	}
-	else
-	{
-		if(LastPhysMExpr)
-			LastPhysMExpr->SetNextMExpr(MExpr);	
-		else
-			FirstPhysMExpr = MExpr;
-		
-		LastPhysMExpr = MExpr;
-		
-	}
-	
-	// if there is a winner found before, count the number of plans
-	if (count != -1) count++;
-	if(COVETrace)	//New MExpr
-	{
-		char buffer[10]; //Holds input group ID
-		CString temp;
-		int arity = MExpr -> GetArity();
-		if(arity){
-			for(int i = 0; i < arity; i++){
-				(void)itoa(MExpr -> GetInput(i), buffer, 10);
-				temp = temp + " "+ buffer;
-			}
-		}
-		temp += " ";
-		
-		CString os;
-		os.Format("addExp { %d %d \" %s  \"%s} %s",
-			
-			GroupID, int(MExpr), MExpr -> GetOp() -> Dump(),
-			temp, LogProp -> DumpCOVE()
-			);
-		
-		OutputCOVE.Write(os, os.GetLength());
-	}
-}  
-
-//##ModelId=3B0C08670044
-void GROUP::set_optimized (bool is_optimized) 
-{ 
-	SET_TRACE Trace(true);
-	
-	if(is_optimized)  
-	{
-		PTRACE("group %d is completed", GroupID); 
-	}
-	
-	State.optimized = is_optimized; 
-	
-}
-
-//##ModelId=3B0C086700BC
-void GROUP::ShrinkSubGroup()
-{
-	for(M_EXPR * MExpr = FirstLogMExpr; 
-		MExpr!=NULL; 
-		MExpr=MExpr->GetNextMExpr())
-	{
-		for(int i=0; i< MExpr->GetArity(); i++)
-			Ssp->ShrinkGroup(MExpr->GetInput(i));
-	}
-}
-
-// Delete a physical MExpr from a group, save memory
-//##ModelId=3B0C086700BD
-void GROUP::DeletePhysMExpr (M_EXPR * PhysMExpr)
-{
-	M_EXPR * MExpr = FirstPhysMExpr;
-	M_EXPR *next;
-	if (MExpr == PhysMExpr)
-	{
-		FirstPhysMExpr = MExpr->GetNextMExpr();
-		// if the MExpr to be deleted is the only one in the group, 
-		// set both First and Last Physical MExpr to be NULL
-		if (FirstPhysMExpr == NULL)
-			LastPhysMExpr = NULL;
-		delete MExpr;
-		MExpr = NULL;
-	}
-	else
-	{
-		// search for the MExpr to be deleted in the link list
-		while (MExpr != NULL)
-		{
-			next = MExpr->GetNextMExpr();
-			// if found, manipulate the pointers and delete the necessary one
-			if (next == PhysMExpr)
-			{
-				MExpr->SetNextMExpr(next->GetNextMExpr());
-				if (next->GetNextMExpr() == NULL)
-					LastPhysMExpr = MExpr;
-				delete next;
-				next = NULL;
-				break;
-			}
-			MExpr = MExpr->GetNextMExpr();
-		}
-	}
-} 
-
-//##ModelId=3B0C086603D1
-CString GROUP::Dump()
-{
-	CString os;
-	int Size = 0;
-	CString temp;
-	M_EXPR* MExpr;
-	
-	os.Format("%s%d%s\r\n","----- Group ", GroupID , " : -----");
-	
-	for(MExpr=FirstLogMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
-	{
-		os += MExpr->Dump();
-		os += " ; ";
-		Size++;
-	}
-	for(MExpr=FirstPhysMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
-	{
-		os += MExpr->Dump();
-		os += " ; ";
-		Size++;
-	}
-	temp.Format("\r\n%s%d%s", "----- has " , Size , " MExprs -----\r\n");
-	os += temp;
-	
-	//Print Winner's circle
-	os += "Winners:\r\n" ;
-	
-#ifdef IRPROP
-	os += M_WINNER::mc[GroupID]->Dump();
-	os += "\r\n";
-#else
-	
-	Size = Winners.GetSize();
-	PHYS_PROP * PhysProp;
-	if(!Size) os += "\tNo Winners\r\n";
-	for(int i = 0; i < Size; i++) 
-	{
-		PhysProp = Winners[i] -> GetPhysProp();
-		os += "\t" ;
-		os += PhysProp -> Dump();
-		os += ", " ;
-		os += ( Winners[i]->GetMPlan() ? Winners[i]->GetMPlan()-> Dump() : "NULL Plan");
-		os += ", " ;
-		os += (Winners[i]->GetCost() ? Winners[i]->GetCost()->Dump() : "NULL Cost");
-		os += ", " ;
-		os += (Winners[i]->GetDone() ? "Done" : "Not done");
-		os += "\r\n";
-	}
-#endif
-	
-	temp.Format("LowerBound: %s\r\n", LowerBd->Dump() );
-	os += temp;
-	
-	os += "log_prop: ";
-	os += (*LogProp).Dump();
-	
-	return os;
-}
-
-//##ModelId=3B0C086603D2
-void GROUP::FastDump()
-{
-	int Size = 0;
-	M_EXPR* MExpr;
-	
-	TRACE_FILE("----- Group %d : -----\r\n", GroupID);
-	
-	
-	for(MExpr=FirstLogMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )
-	{
-		TRACE_FILE("%s ; ", MExpr->Dump() );
-		Size++;
-	}
-	for(MExpr=FirstPhysMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
-	{
-		TRACE_FILE("%s ; ", MExpr->Dump() );
-		Size++;
-	}
-	
-	TRACE_FILE("\r\n----- has %d MExprs -----\r\n", Size );
-	
-	//Print Winner's circle
-	TRACE_FILE("%s", "Winners:\r\n" );
-	
-#ifdef IRPROP
-	TRACE_FILE("\t%s\n", M_WINNER::mc[GroupID]->Dump());
-#else
-	Size = Winners.GetSize();
-	PHYS_PROP * PhysProp;
-	if(!Size) TRACE_FILE("%s", "\tNo Winners\r\n" );
-	for(int i = 0; i < Size; i++) 
-	{
-		PhysProp = Winners[i] -> GetPhysProp();
-		TRACE_FILE("\t%s", PhysProp -> Dump() );
-		TRACE_FILE(", %s", ( Winners[i]->GetMPlan() ? Winners[i]->GetMPlan()-> Dump() : "NULL") );
-		TRACE_FILE(", %s", (Winners[i]->GetCost() ? Winners[i]->GetCost()->Dump() : "-1") );
-		TRACE_FILE(", %s\r\n", (Winners[i]->GetDone() ? "Done" : "Not done") );
-	}
-#endif
-	
-	TRACE_FILE("LowerBound: %s\r\n", LowerBd->Dump() );
-	
-	TRACE_FILE("log_prop: %s", (*LogProp).Dump() );
-}
+/*	
+group.cpp -  implementation of class GROUP
+	$Revision: 12 $
+	Implements class GROUP as defined in ssp.h
+
+	Columbia Optimizer Framework
+
+	A Joint Research Project of Portland State University 
+	   and the Oregon Graduate Institute
+	Directed by Leonard Shapiro and David Maier
+	Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+	
+*/
+#include "stdafx.h"
+#include "ssp.h"
+#include "bound.h"
+#include "rules.h"
+
+#ifdef _DEBUG
+	#define new DEBUG_NEW
+#endif
+
+//##ModelId=3B0C086603C7
+GROUP::GROUP(M_EXPR * MExpr)
+:GroupID(MExpr->GetGrpID()), 
+FirstLogMExpr(MExpr), LastLogMExpr(MExpr), 
+FirstPhysMExpr(NULL), LastPhysMExpr(NULL), SpillPos(0)
+{
+	if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_GROUP].New();
+	
+	init_state();
+	
+	LogProp = NewLogProp(MExpr);
+	int arity = MExpr->GetArity();
+	
+	// the bounds of the inputs are found by now, see bound.h
+	LowerBd = new COST(Ctx->Bound->Find(this));
+	
+	/* if the operator is EQJOIN with m tables, estimate group size
+	   is 2^m*2.5. else it is zero */
+	if ( MExpr->GetOp()->GetName().Compare("EQJOIN") == 0)
+	{
+		int NumTables = this->EstimateNumTables(MExpr);
+		EstiGrpSize = pow(2, NumTables)*2.5;
+	}
+	else
+		EstiGrpSize = 0;
+	
+	// the initial value is -1, meaning no winner has been found
+	count = -1;
+	if(Ctx->COVETrace)	//New Group
+	{
+		char buffer[10]; //Holds input group ID
+		CString temp;
+		if(arity){
+			for(int i = 0; i < arity; i++){
+				(void)itoa(MExpr -> GetInput(i), buffer, 10);
+				temp = temp + " "+ buffer;
+			}
+		}
+		temp += " ";
+		
+		CString os;
+		os.Format("addGroup { %d %d \" %s  \"%s} %s",
+			
+			GroupID, int((size_t)MExpr), MExpr -> GetOp() -> Dump(),
+			temp, LogProp -> DumpCOVE()
+			);
+		
+		Ctx->OutputCOVE.Write(os, os.GetLength());
+	}
+	if(Ctx->BinaryTrace) Ctx->TraceBuffer->NewGroup(this, MExpr);
+}
+
+// find the log prop, shared with the other groups and queries which
+// have the same GET or join, see LOG_PROP_CACHE
+LOG_PROP * GROUP::NewLogProp(M_EXPR * MExpr)
+{
+	LOG_PROP * Prop;
+	int arity = MExpr->GetArity();
+	LOG_PROP ** InputProp=NULL;
+	if(arity==0)
+	{	Prop = Ctx->PropCache->Find(MExpr->GetOp(), InputProp);
+	}
+	else
+	{
+		InputProp = new LOG_PROP* [arity];
+		GROUP *Group;
+		for(int i=0; i<arity; i++)
+		{	
+			Group = Ctx->Ssp->GetGroup(MExpr->GetInput(i));
+			InputProp[i] = Group->LogProp;
+		}
+		
+		Prop = Ctx->PropCache->Find(MExpr->GetOp(), InputProp);
+		
+		delete [] InputProp;
+	}
+	return Prop;
+}
+
+// The group Store() wrote into a snapshot.  The logical mexprs are not in
+// the hash table yet, SSP(ARCHIVE &) puts them there.
+GROUP::GROUP(ARCHIVE & Ar, GRP_ID GrpID)
+:GroupID(GrpID), 
+FirstLogMExpr(NULL), LastLogMExpr(NULL), 
+FirstPhysMExpr(NULL), LastPhysMExpr(NULL), SpillPos(0)
+{
+	if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_GROUP].New();
+	
+	init_state();
+	
+	int Explored, Optimized, Count;
+	double Bound;
+	Ar >> Explored >> Optimized;
+	State.explored = (Explored != 0);
+	State.optimized = (Optimized != 0);
+	LogProp = LOG_PROP::Load(Ar);
+	Ar >> Bound >> EstiGrpSize >> count;
+	LowerBd = new COST(Bound);
+	
+	LoadLogMExprs(Ar);
+	Ar >> Count;
+	for (int i = 0; i < Count; i++)
+	{
+		M_EXPR * MExpr = new M_EXPR(Ar, GroupID);
+		if (LastPhysMExpr) LastPhysMExpr->SetNextMExpr(MExpr);
+		else FirstPhysMExpr = MExpr;
+		LastPhysMExpr = MExpr;
+	}
+	
+#ifndef IRPROP
+	Ar >> Count;
+	for (int j = 0; j < Count; j++) Winners.Add(new WINNER(Ar, GroupID));
+#endif
+}
+
+void GROUP::Store(ARCHIVE & Ar)
+{
+	int Count = 0;
+	M_EXPR * MExpr;
+	
+	Ar << (int)State.explored << (int)State.optimized;
+	LogProp->Store(Ar);
+	Ar << LowerBd->GetValue() << EstiGrpSize << count;
+	
+	StoreLogMExprs(Ar);
+	for (MExpr = FirstPhysMExpr; MExpr != NULL; MExpr = MExpr->GetNextMExpr()) Count++;
+	Ar << Count;
+	for (MExpr = FirstPhysMExpr; MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		MExpr->Store(Ar);
+	
+#ifndef IRPROP
+	Ar << (int)Winners.GetSize();
+	for (int i = 0; i < Winners.GetSize(); i++) Winners[i]->Store(Ar);
+#endif
+}
+
+// The inputs of the group, or the group itself, may have been optimized
+// since the bound was found.  The bound is only raised, the tasks keep
+// pointers to it in their input costs.
+void GROUP::RefineLowerBd()
+{
+	if (FirstLogMExpr == NULL) return;	// spilled, see SSP::SpillCold()
+	double Bound = Ctx->Bound->Find(this);
+	if (Bound > LowerBd->GetValue()) *LowerBd = COST(Bound);
+}
+
+// The winners and the physical mexprs were found with the cost model and
+// the statistics as they were.  The logical mexprs stay, with the
+// transformation rules fired on them.  An optimized group has all of them,
+// so it is taken as explored, and O_GROUP optimizes each of them again.
+void GROUP::Invalidate()
+{
+	while (FirstPhysMExpr != NULL)
+	{
+		M_EXPR * MExpr = FirstPhysMExpr;
+		FirstPhysMExpr = MExpr->GetNextMExpr();
+		delete MExpr;
+	}
+	LastPhysMExpr = NULL;
+	
+#ifdef IRPROP
+	Ctx->mc[GroupID]->Reset();
+#else
+	for (int i = 0; i < Winners.GetSize(); i++)
+		delete Winners[i];
+	Winners.RemoveAll();
+#endif
+	count = -1;
+	
+	for (M_EXPR * MExpr = FirstLogMExpr; MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		for (int RuleNo = 0; RuleNo < Ctx->RuleSet->RuleCount; RuleNo++)
+		{
+			RULE * Rule = (*Ctx->RuleSet)[RuleNo];
+			if (Rule != NULL && Rule->GetSubstitute()->GetOp()->is_physical())
+				MExpr->unfire_rule(Rule->get_index());
+		}
+	
+	if (State.optimized) State.explored = true;
+	State.optimized = false;
+	set_changed(true);
+}
+
+void GROUP::FindLogProp()
+{
+	LOG_PROP * Old = LogProp;
+	LogProp = NewLogProp(FirstLogMExpr);
+	Old->Release();
+}
+
+// No task holds the bound now, see RefineLowerBd()
+void GROUP::FindLowerBd()
+{
+	*LowerBd = COST(Ctx->Bound->Find(this));
+}
+
+// free up memory
+//##ModelId=3B0C086603C9
+GROUP::~GROUP()
+{
+	if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_GROUP].Delete();
+	
+	LogProp->Release();
+	delete LowerBd;
+	
+	M_EXPR * mexpr =FirstLogMExpr;
+	M_EXPR * next = mexpr;
+	while( next!=NULL )
+	{	next = mexpr->GetNextMExpr();
+		delete mexpr; 
+		mexpr = next;
+	}
+	
+	mexpr =FirstPhysMExpr;
+	next = mexpr;
+	while( next!=NULL )
+	{	next = mexpr->GetNextMExpr();
+		delete mexpr; 
+		mexpr = next;
+	}
+	
+#ifndef IRPROP
+	for(int i=0;i<Winners.GetSize();i++)
+		delete Winners[i];
+#endif
+	
+}
+
+// estimate the number of tables in EQJOIN
+//##ModelId=3B0C086701FC
+int  GROUP::EstimateNumTables(M_EXPR * MExpr)
+{
+	int table_num;
+	int total=0;
+	GROUP *Group;
+	int arity = MExpr->GetArity();
+	// if the input is EQJOIN, continue to count all the input
+	for(int i=0; i<arity; i++)
+	{	
+		Group = Ctx->Ssp->GetGroup(MExpr->GetInput(i));
+		if (Group->GetFirstLogMExpr()->GetOp()->GetName().Compare("EQJOIN") == 0)
+		{
+			table_num = Group->EstimateNumTables(Group->GetFirstLogMExpr());
+		}
+		else table_num=1;
+		total += table_num;
+	}
+	return total;
+}
+
+//##ModelId=3B0C08670089
+void GROUP::NewMExpr(M_EXPR *MExpr) 
+{
+	// link to last mexpr
+	if(MExpr->GetOp()->is_logical())
+	{
+		LastLogMExpr->SetNextMExpr(MExpr);	
+		LastLogMExpr = MExpr;
+	}
+	else
+	{
+		if(LastPhysMExpr)
+			LastPhysMExpr->SetNextMExpr(MExpr);	
+		else
+			FirstPhysMExpr = MExpr;
+		
+		LastPhysMExpr = MExpr;
+		
+	}
+	
+	// if there is a winner found before, count the number of plans
+	if (count != -1) count++;
+	if(Ctx->COVETrace)	//New MExpr
+	{
+		char buffer[10]; //Holds input group ID
+		CString temp;
+		int arity = MExpr -> GetArity();
+		if(arity){
+			for(int i = 0; i < arity; i++){
+				(void)itoa(MExpr -> GetInput(i), buffer, 10);
+				temp = temp + " "+ buffer;
+			}
+		}
+		temp += " ";
+		
+		CString os;
+		os.Format("addExp { %d %d \" %s  \"%s} %s",
+			
+			GroupID, int((size_t)MExpr), MExpr -> GetOp() -> Dump(),
+			temp, LogProp -> DumpCOVE()
+			);
+		
+		Ctx->OutputCOVE.Write(os, os.GetLength());
+	}
+	if(Ctx->BinaryTrace) Ctx->TraceBuffer->NewMExpr(MExpr);
+}  
+
+//##ModelId=3B0C08670044
+void GROUP::set_optimized (bool is_optimized) 
+{ 
+	SET_TRACE Trace(true);
+	
+	if(is_optimized)  
+	{
+		PTRACE("group %d is completed", GroupID); 
+	}
+	
+	State.optimized = is_optimized; 
+	
+}
+
+//##ModelId=3B0C086700BC
+void GROUP::ShrinkSubGroup()
+{
+	for(M_EXPR * MExpr = FirstLogMExpr; 
+		MExpr!=NULL; 
+		MExpr=MExpr->GetNextMExpr())
+	{
+		for(int i=0; i< MExpr->GetArity(); i++)
+			Ctx->Ssp->ShrinkGroup(MExpr->GetInput(i));
+	}
+}
+
+// Delete a physical MExpr from a group, save memory
+//##ModelId=3B0C086700BD
+void GROUP::DeletePhysMExpr (M_EXPR * PhysMExpr)
+{
+	M_EXPR * MExpr = FirstPhysMExpr;
+	M_EXPR *next;
+	if (MExpr == PhysMExpr)
+	{
+		FirstPhysMExpr = MExpr->GetNextMExpr();
+		// if the MExpr to be deleted is the only one in the group, 
+		// set both First and Last Physical MExpr to be NULL
+		if (FirstPhysMExpr == NULL)
+			LastPhysMExpr = NULL;
+		delete MExpr;
+		MExpr = NULL;
+	}
+	else
+	{
+		// search for the MExpr to be deleted in the link list
+		while (MExpr != NULL)
+		{
+			next = MExpr->GetNextMExpr();
+			// if found, manipulate the pointers and delete the necessary one
+			if (next == PhysMExpr)
+			{
+				MExpr->SetNextMExpr(next->GetNextMExpr());
+				if (next->GetNextMExpr() == NULL)
+					LastPhysMExpr = MExpr;
+				delete next;
+				next = NULL;
+				break;
+			}
+			MExpr = MExpr->GetNextMExpr();
+		}
+	}
+} 
+
+#ifndef IRPROP
+// Delete the physical mexprs which are not the plan of a winner, to save
+// memory.  Only when every winner has a plan, else a later search of the
+// group with a higher bound needs them.  Return the number deleted.
+int GROUP::DeleteLosers()
+{
+	int i, Size = Winners.GetSize();
+	for (i = 0; i < Size; i++)
+		if (Winners[i]->GetMPlan() == NULL) return 0;
+	
+	int DeleteCount = 0;
+	M_EXPR * Prev = NULL;
+	M_EXPR * MExpr = FirstPhysMExpr;
+	while (MExpr != NULL)
+	{
+		M_EXPR * Next = MExpr->GetNextMExpr();
+		for (i = 0; i < Size && Winners[i]->GetMPlan() != MExpr; i++) ;
+		if (i < Size)
+			Prev = MExpr;		// a winner, kept
+		else
+		{
+			if (Prev) Prev->SetNextMExpr(Next);
+			else FirstPhysMExpr = Next;
+			delete MExpr;
+			DeleteCount++;
+		}
+		MExpr = Next;
+	}
+	LastPhysMExpr = Prev;
+	if (DeleteCount) set_changed(true);
+	
+	return DeleteCount;
+}
+#endif
+
+// The logical mexprs of a spilled group are written into Ar, with their
+// fired rules, and deleted.  The group keeps its logical properties, its
+// winners and its physical mexprs, which the plans are made of.
+void GROUP::StoreLogMExprs(ARCHIVE & Ar)
+{
+	int Count = 0;
+	M_EXPR * MExpr;
+	for (MExpr = FirstLogMExpr; MExpr != NULL; MExpr = MExpr->GetNextMExpr()) Count++;
+	
+	Ar << Count;
+	for (MExpr = FirstLogMExpr; MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		MExpr->Store(Ar);
+}
+
+void GROUP::DeleteLogMExprs()
+{
+	while (FirstLogMExpr != NULL)
+	{
+		M_EXPR * MExpr = FirstLogMExpr;
+		FirstLogMExpr = MExpr->GetNextMExpr();
+		delete MExpr;
+	}
+	LastLogMExpr = NULL;
+	State.spilled = true;
+}
+
+void GROUP::LoadLogMExprs(ARCHIVE & Ar)
+{
+	int Count;
+	Ar >> Count;
+	for (int i = 0; i < Count; i++)
+	{
+		M_EXPR * MExpr = new M_EXPR(Ar, GroupID);
+		if (LastLogMExpr) LastLogMExpr->SetNextMExpr(MExpr);
+		else FirstLogMExpr = MExpr;
+		LastLogMExpr = MExpr;
+	}
+	State.spilled = false;
+}
+
+//##ModelId=3B0C086603D1
+CString GROUP::Dump()
+{
+	CString os;
+	int Size = 0;
+	CString temp;
+	M_EXPR* MExpr;
+	
+	os.Format("%s%d%s\r\n","----- Group ", GroupID , " : -----");
+	
+	for(MExpr=FirstLogMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
+	{
+		os += MExpr->Dump();
+		os += " ; ";
+		Size++;
+	}
+	if (State.spilled) os += "(logical mexprs spilled) ; ";
+	for(MExpr=FirstPhysMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
+	{
+		os += MExpr->Dump();
+		os += " ; ";
+		Size++;
+	}
+	temp.Format("\r\n%s%d%s", "----- has " , Size , " MExprs -----\r\n");
+	os += temp;
+	
+	//Print Winner's circle
+	os += "Winners:\r\n" ;
+	
+#ifdef IRPROP
+	os += Ctx->mc[GroupID]->Dump();
+	os += "\r\n";
+#else
+	
+	Size = Winners.GetSize();
+	PHYS_PROP * PhysProp;
+	if(!Size) os += "\tNo Winners\r\n";
+	for(int i = 0; i < Size; i++) 
+	{
+		PhysProp = Winners[i] -> GetPhysProp();
+		os += "\t" ;
+		os += PhysProp -> Dump();
+		os += ", " ;
+		os += ( Winners[i]->GetMPlan() ? Winners[i]->GetMPlan()-> Dump() : "NULL Plan");
+		os += ", " ;
+		os += (Winners[i]->GetCost() ? Winners[i]->GetCost()->Dump() : "NULL Cost");
+		os += ", " ;
+		os += (Winners[i]->GetDone() ? "Done" : "Not done");
+		os += "\r\n";
+	}
+#endif
+	
+	temp.Format("LowerBound: %s\r\n", LowerBd->Dump() );
+	os += temp;
+	
+	os += "log_prop: ";
+	os += (*LogProp).Dump();
+	
+	return os;
+}
+
+//##ModelId=3B0C086603D2
+void GROUP::FastDump()
+{
+	int Size = 0;
+	M_EXPR* MExpr;
+	
+	TRACE_FILE("----- Group %d : -----\r\n", GroupID);
+	
+	
+	for(MExpr=FirstLogMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )
+	{
+		TRACE_FILE("%s ; ", MExpr->Dump() );
+		Size++;
+	}
+	if (State.spilled) { TRACE_FILE("%s ; ", "(logical mexprs spilled)"); }
+	for(MExpr=FirstPhysMExpr; MExpr!=NULL; MExpr = MExpr->GetNextMExpr() )	
+	{
+		TRACE_FILE("%s ; ", MExpr->Dump() );
+		Size++;
+	}
+	
+	TRACE_FILE("\r\n----- has %d MExprs -----\r\n", Size );
+	
+	//Print Winner's circle
+	TRACE_FILE("%s", "Winners:\r\n" );
+	
+#ifdef IRPROP
+	TRACE_FILE("\t%s\n", Ctx->mc[GroupID]->Dump());
+#else
+	Size = Winners.GetSize();
+	PHYS_PROP * PhysProp;
+	if(!Size) TRACE_FILE("%s", "\tNo Winners\r\n" );
+	for(int i = 0; i < Size; i++) 
+	{
+		PhysProp = Winners[i] -> GetPhysProp();
+		TRACE_FILE("\t%s", PhysProp -> Dump() );
+		TRACE_FILE(", %s", ( Winners[i]->GetMPlan() ? Winners[i]->GetMPlan()-> Dump() : "NULL") );
+		TRACE_FILE(", %s", (Winners[i]->GetCost() ? Winners[i]->GetCost()->Dump() : "-1") );
+		TRACE_FILE(", %s\r\n", (Winners[i]->GetDone() ? "Done" : "Not done") );
+	}
+#endif
+	
+	TRACE_FILE("LowerBound: %s\r\n", LowerBd->Dump() );
+	
+	TRACE_FILE("log_prop: %s", (*LogProp).Dump() );
+}
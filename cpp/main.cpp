@@ -1,466 +1,1255 @@
-/*	
-main.cpp -  main file of the columbia optimizer
-$Revision: 27 $
-Columbia Optimizer Framework
-
-  A Joint Research Project of Portland State University 
-  and the Oregon Graduate Institute
-  Directed by Leonard Shapiro and David Maier
-  Supported by NSF Grants IRI-9610013 and IRI-9619977
-*/
-
-#include "stdafx.h"
-#include "cat.h"
-#include "cm.h"
-#include "tasks.h"
-#include "physop.h"
-
-#include "global.h"			// global variables
-
-
-#define LINEWIDTH 256		// buffer length of one text line
-#define KEYWORD_NUMOFQRY "NumOfQuery:"
-#define KEYWORD_QUERY "Query:"
-#define KEYWORD_PIGGYBACK "PiggyBack"
-
-#ifdef _DEBUG
-	#define new DEBUG_NEW
-	 CMemoryState oldMemState, newMemState, diffMemState;
-#endif
-
-#ifdef _DEBUG
-//Rule Firing Statistics
-INT_ARRAY TopMatch;
-INT_ARRAY Bindings;
-INT_ARRAY Conditions;
-#endif
-
-
-/*************  DO THE OPTIMIZATION  ********************/
-void Optimizer()
-{
-	//Initialize
-	TaskNo = 0;
-	Memo_M_Exprs = 0;
-	SET_TRACE Trace(true);
-	if(CatFile=="catalog") CatFile = AppDir + "\\catalog";	
-	if(CMFile=="cm") CMFile = AppDir + "\\cm";			
-	if(RSFile=="ruleset") RSFile = AppDir + "\\ruleset";
-	
-	//Open general trace file and COVE trace file, clear main output window
-	OutputFile.Open( AppDir + "\\colout.txt" , CFile::modeCreate | CFile::modeWrite );
-	OutputCOVE.Open( AppDir + "\\script.cove" , CFile::modeCreate | CFile::modeWrite );
-	OutputWindow->ClearWindow();
-    
-	// clean the statistics
-    for(int i=0; i < CLASS_NUM; i++)
-    {
-		ClassStat[i].Count = 0;
-		ClassStat[i].Max = 0;
-		ClassStat[i].Total = 0;
-    }
-	
-#ifdef USE_MEMORY_MANAGER
-	// Pointer to global memory manager.
-	memory_manager = new MEMORY_MANAGER();
-#endif
-	
-	// Create objects to manage Opt stats, Cost model, Rule set, Heuristic cost.
-	OptStat = new OPT_STAT;	
-	Cm = new CM(CMFile);
-	PTRACE("cost model content:\r\n%s", Cm->Dump());
-	RuleSet = new RULE_SET(RSFile);
-	PTRACE("Rule set content:\r\n%s", RuleSet->Dump());
-	COST *HeuristicCost;
-	HeuristicCost = new COST(0);
-	
-#ifdef _DEBUG
-	//Initialize Rule Firing Statistics
-	TopMatch.SetSize(RuleSet->RuleCount);
-	Bindings.SetSize(RuleSet->RuleCount);
-	Conditions.SetSize(RuleSet->RuleCount);	//625
-	for (int RuleNum = 0; RuleNum < RuleSet->RuleCount ; RuleNum++)
-	{
-		TopMatch[RuleNum] = 0;
-		Bindings[RuleNum] = 0;
-		Conditions[RuleNum] = 0;
-	}
-#endif
-	
-	//SQueryFile, BQueryFile have been set to the Single or Batch Query File chosen in
-	//  the option dialog.  The CString QueryFile will be set to the name of a file 
-	//  containing the query currently being optimized.  In the single query case that 
-	//  will be SQueryFile, in the Batch Query case it will be "tempquery", which will
-	//  contain the current batch query, copied from BQueryFile.  The default case is 
-	//  handled separately, with files named query and bquery.
-	//NumQuery will be set here to the number of queries.
-	CString QueryFile;
-	int NumQuery;
-	FILE *fp;	//for the batch query file BQueryFile
-	char TextLine[LINEWIDTH]; // text line buffer
-	char *p;
-	if (RadioVal == 1)	// Single Query case
-	{
-		if(SQueryFile=="query") QueryFile = AppDir + "\\query";	//default case
-		else QueryFile = SQueryFile;  //value entered in option dialog; should check it exists.
-		NumQuery = 1;
-	}
-	else if (RadioVal == 0)	//Batch Query case
-	{
-		//Open BQueryFile
-		if(BQueryFile=="bquery") BQueryFile = AppDir + "\\bquery";	//default case
-		if((fp = fopen(BQueryFile,"r"))==NULL) 
-			OUTPUT_ERROR("can not open the file you chose in the option dialogue");
-		fgets(TextLine,LINEWIDTH,fp);
-		if(feof(fp))OUTPUT_ERROR("Empty Input File");
-		
-	}
-	
-	//The following loop is executed once for the single query case.
-	//For the batch case, it is executed once for each batch query 
-	//sequence. Executes batch of batches too.
-	do
-	{
-		
-		if (RadioVal == 0)    //Batch Query case
-		{
-			
-			//Set NumQuery = Number of Queries in the batch
-			//Set the PiggyBack flag to be true if the batch  
-			//query needs to be PiggyBacked,else the PiggyBack 
-			//flag remains false.
-			
-			PiggyBack = false;
-			for (;;)
-			{
-				// skip the comment line
-				if (IsCommentOrBlankLine(TextLine) ) {
-					fgets(TextLine, LINEWIDTH, fp);
-					continue;
-				}
-				
-				p = SkipSpace(TextLine);
-				if( p == strstr(p , KEYWORD_PIGGYBACK) )
-				{
-					p += strlen(KEYWORD_PIGGYBACK); 
-					p = SkipSpace(p); 
-					
-					PiggyBack=true;
-					
-					fgets(TextLine,LINEWIDTH,fp);
-					
-					continue;
-				}
-				if( p == strstr(p , KEYWORD_NUMOFQRY) )
-				{
-					p += strlen(KEYWORD_NUMOFQRY); 
-					p = SkipSpace(p);
-					parseString(p); 
-					
-					NumQuery = atoi(p);	// NumQuery is set here
-					break;
-				}
-				else
-					OUTPUT_ERROR("the first line in the batch file should be number of queries");
-			}
-		}
-		
-		//Header for single line batch output
-		if(SingleLineBatch)
-			OUTPUT("%s", "#\tTTask\tTGrp\tCME\tTME\tFR\tCOST\r\n");
-		
-		//For each query numbered q
-		bool first = true; //treat the first "Query: n" specially
-		for (int q = 0; q < NumQuery; q++)
-		{
-			if (RadioVal == 0)	//Batch case
-			{
-				// reset the interesting queries & M_WINNERs, clean the statistics                                                 
-				IntOrdersSet.reset();
-#ifdef IRPROP
-				//In PiggyBack mode remove the winners only when the first
-				//query in a batch is created,for the remaining queries read in keep 
-				//the winners created for previous queries optimized
-				if ((PiggyBack && (0 == q)) || (!PiggyBack))
-				{M_WINNER::mc.RemoveAll();}
-				
-#endif
-				
-				for(int i=0; i < CLASS_NUM; i++)
-					ClassStat[i].Count = ClassStat[i].Max = ClassStat[i].Total = 0;
-				OptStat->DupMExpr  = OptStat->FiredRule  = OptStat->HashedMExpr = 0;
-				OptStat->MaxBucket = OptStat->TotalMExpr = 0;
-#ifdef _DEBUG
-				for (int RuleNum = 0; RuleNum < RuleSet->RuleCount; RuleNum++)
-				{
-					TopMatch[RuleNum] = 0;
-					Bindings[RuleNum] = 0;
-					Conditions[RuleNum] = 0;
-				}
-#endif
-				TaskNo = 0;
-				Memo_M_Exprs = 0;
-				
-				QueryFile = AppDir + "\\tempquery";
-				FILE *tempfp;
-				if ((tempfp = fopen(QueryFile.GetBuffer(200), "w")) == NULL)
-					OUTPUT_ERROR("can not create or truncate file 'tempquery'");
-				QueryFile.ReleaseBuffer(-1);
-				/*
-				here the optimizer reads in one query at a time  
-				until the keyword KEYWORD_QUERY,KEYWORD_NUMOFQRY
-				or KEYWORD_PIGGYBACK or end of a file is encountered 
-				from each query, be it from a single,batch or batch 
-				of batches query and stores it in a file called tempquery.
-				The line containing keyword KEYWORD_QUERY,KEYWORD_NUMOFQRY
-				or KEYWORD_PIGGYBACK serves as a demarcator for the optimizer 
-				to break out of the for loop ,process and optimize the query 
-				last read before reentering the loop to write another query 
-				,if any ,starting reading after the line containing the 
-				keyword KEYWORD_QUERY,KEYWORD_NUMOFQRY
-				or KEYWORD_PIGGYBACK,to the tempquery file to be processed
-				and optimized
-				
-				*/	 
-				for (;;)
-				{
-					fgets(TextLine, LINEWIDTH, fp);
-					if (feof(fp))
-					{
-						fprintf(tempfp, "%s", TextLine);
-						break;
-					}
-					if (IsCommentOrBlankLine(TextLine)) continue;
-					p = SkipSpace(TextLine);
-					if (p == strstr(p, KEYWORD_QUERY)    ||
-						p == strstr(p, KEYWORD_NUMOFQRY) ||
-						p == strstr(p, KEYWORD_PIGGYBACK)) {
-						if (first) {
-							first=false;
-							continue;
-						}
-						else break;
-					}
-					else
-						fprintf(tempfp, "%s", TextLine);
-				}
-				fclose(tempfp);
-				
-			}
-			
-			//Print the number of the query
-#ifndef _TABLE_
-			if(SingleLineBatch)
-			{
-				OUTPUT("%d\t",q);	//First entry in output line in window
-			}
-			else
-				OUTPUT("Query: %d\r\n", q+1);	//In this case it's a full line
-#endif
-			
-			
-			// if GlobepsPruning, run optimizer without globepsPruning
-			// to get the heuristic cost
-			if(GlobepsPruning)
-			{
-				GlobepsPruning      = false;
-				ForGlobalEpsPruning = true;
-				Cat                 = new CAT(CatFile);
-				Query               = new QUERY(QueryFile);
-				Ssp                 = new SSP;
-				Ssp->Init();
-				delete Query;
-				Ssp->optimize();
-				PHYS_PROP * PhysProp = CONT::vc[0]->GetPhysProp();
-				*HeuristicCost = *(Ssp->GetGroup(0)->GetWinner(PhysProp)->GetCost());
-				assert(Ssp->GetGroup(0)->GetWinner(PhysProp) ->GetDone());
-				GlobalEpsBound = (*HeuristicCost) * (GLOBAL_EPS);
-				delete Ssp;
-				for (int i = 0; i < CONT::vc.GetSize(); i++)
-					delete CONT::vc[i];
-				CONT::vc.RemoveAll();
-				delete Cat;
-				GlobepsPruning      = true;
-				ForGlobalEpsPruning = false;
-			}
-#ifdef _DEBUG
-			oldMemState.Checkpoint();
-#endif
-			
-			//Since each optimization corrupts the catalog, we must create it anew
-			Cat = new CAT(CatFile);
-			PTRACE("Catalog content:\r\n%s", Cat->Dump());
-			
-#ifdef _TABLE_
-			assert(!SingleLineBatch);	//These are incompatible
-			
-			//	Print Heading: EPS ...
-			OUTPUT("%s", "EPS, EPS_BD, CUREXPR, TOTEXPR, TASKS, OPTCOST\r\n");
-			
-			// For each iteration of the global epsilon counter ii {
-			for (double ii = 0; ii <= GLOBAL_EPS*10; ii++)
-			{
-				OUTPUT("%3.1f\t", ii / 10 );
-				GlobalEpsBound = (*HeuristicCost) * ii / 10;
-				ClassStat[C_M_EXPR].Count = ClassStat[C_M_EXPR].Total = 0;
-#endif
-				
-				//Parse and print the query and its interesting orders
-				Query = new QUERY(QueryFile);
-				PTRACE("Original Query:\r\n%s", Query->Dump());
-				PTRACE("The interesting orders in the query are:\r\n%s\n", Query->Dump_IntOrders());
-				
-				//Initialize and print the search space, delete the query
-				// In PiggyBack mode create the search space only for 
-				// the first query(q == 0)and keep expanding it as more and 
-				// more queries are read
-				//In non PiggyBack mode create a new search space(Ssp) for  
-				//every query read because the search space for the previous 
-				//query is deleted after it is optimized
-				if ((PiggyBack && (0 == q)) || (!PiggyBack))
-				{
-					Ssp = new SSP;
-				}
-				
-				Ssp->Init();
-				PTRACE("Initial Search Space:\r\n%s", Ssp->Dump());
-				delete Query;
-				
-				//Keep track of initial space and time
-				PTRACE("---1--- memory statistics before optimization: %s", DumpStatistics());
-				PTRACE("used memory before opt: %dK\r\n",GetUsedMemory()/1000);
-				struct _timeb start, finish;
-				char *timeline;
-				_ftime( &start ); 
-				timeline = ctime(&(start.time));
-				CString tmpbuf;
-				tmpbuf.Format("%.8s.%0.3hu", &timeline[11], start.millitm);
-#ifndef _TABLE_
-				if(!SingleLineBatch)
-					OUTPUT("Optimization beginning time:\t\t%s (hr:min:sec.msec)\r\n", tmpbuf);
-#endif
-				
-				Ssp->optimize();	//Later add an input condition so we can handle ORDER BY
-				
-#ifndef _TABLE_
-				//OUTPUT elapsed time
-				long time;			//total seconds from start to finish
-				unsigned short msecs;	//milliseconds from start to finish
-				_ftime( &finish );
-				if (finish.millitm >= start.millitm)
-				{
-					time  = finish.time - start.time;
-					msecs = finish.millitm - start.millitm;
-				}
-				else
-				{
-					time  = finish.time - start.time - 1;
-					msecs = 1000 + finish.millitm - start.millitm;
-				}
-				long hrs, mins, secs;	// Print differences from start to finish
-				secs = time % 60;
-				mins = ((time - secs)/60) % 60;
-				hrs  = (time - secs - mins * 60) / 3600 ;
-				tmpbuf.Format("%0.2d:%0.2d:%0.2d.%0.3d\r\n", hrs, mins, secs, msecs);
-				if (!SingleLineBatch)
-				{
-					OUTPUT( "Optimization elapsed time:\t\t%s", tmpbuf);
-					OUTPUT("%s", "========  OPTIMAL PLAN =========\r\n");
-				}
-#endif
-				
-				
-				//CopyOut optimal plan. TRACE memory, search space.  
-				PHYS_PROP * PhysProp = CONT::vc[0]->GetPhysProp();
-				/* CopyOut the Optimal plan starting from the RootGID (the root group of
-				our Query )
-				*/
-				Ssp->CopyOut(Ssp->GetRootGID(), PhysProp, 0);
-				PTRACE("used memory after opt: %dK\r\n",GetUsedMemory() / 1000);
-				PTRACE("---2--- memory statistics after optimization: %s", DumpStatistics());
-				if (TraceFinalSSP) {
-					Ssp->FastDump();
-				}
-				else {
-					PTRACE("final Search Space:\r\n%s", Ssp->Dump());
-				}
-				
-				//Delete Contexts, close batch query file, delete search space
-				if(!PiggyBack)
-				{
-					for (i = 0; i < CONT::vc.GetSize(); i++) 
-						delete CONT::vc[i];
-					CONT::vc.RemoveAll();
-				}
-				//if (RadioVal ==0 && q==NumQuery-1) fclose(fp);
-				PTRACE("used memory before deleting the search space: %dM\r\n", GetUsedMemory()/1000);
-				// Go on with the usual procedure of deleting the search space before 
-				// reading in the next query of the batch query file if not in the 
-				// PiggyBack mode 
-				// else keep the search space for reuse
-				if (!PiggyBack)
-					delete Ssp;
-				PTRACE("---3--- memory statistics after freeing searching space: %s", DumpStatistics());
-				
-				//OUTPUT Rule Set Statistics
-#ifdef  _DEBUG
-#ifndef _TABLE_
-				if (!SingleLineBatch)
-					OUTPUT("%s",RuleSet -> DumpStats());
-#endif
-#endif
-				
-#ifdef _TABLE_
-		}
-#endif
-		
-		//Report memory, delete catalog
-		PTRACE("used memory before deleting the catalog: %dM\r\n", GetUsedMemory()/1000);
-		delete Cat;
-	}	//for each query
-	if (RadioVal) 
-		break;  //If single query case, execute only once
-    
-	OUTPUT("%s","\r\n");
-	OUTPUT("%s"," =============END OF A SEQUENCE================ ");
-	OUTPUT("%s","\r\n");
-	
-	//this will be executed only if in PiggyBack mode 
-	//to delete the search space one last time
-	if (PiggyBack) 
-	{
-		delete Ssp;
-		for (i = 0; i < CONT::vc.GetSize(); i++)
-			delete CONT::vc[i];
-		CONT::vc.RemoveAll();
-	}
-	
-   } while (!feof(fp));  // end of do loop  over each batch query sequence
-   
-   
-   
-	  //Free optimization stat object, cost model, rule set, heuristic cost
-	  delete OptStat;	
-	  delete Cm;		
-	  delete RuleSet;	
-	  delete (void*) HeuristicCost; 
-	  
-#ifdef USE_MEMORY_MANAGER
-	  PTRACE("used memory before delete manager: %dM\r\n", GetUsedMemory()/1000);
-	  delete memory_manager ;                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                      
-	  
-#endif
-	  PTRACE("used memory after delete manager: %dM\r\n", GetUsedMemory()/1000);
-	  
-#ifdef _DEBUG
-	  newMemState.Checkpoint();
-	  if (diffMemState.Difference(oldMemState, newMemState))
-	  {
-		  PTRACE("%s", "Memory leaked after optimizer!\n") ;
-		  oldMemState.DumpAllObjectsSince();
-		  diffMemState.DumpStatistics();
-	  }
-#endif
-	  OutputFile.Close();
-	  OutputCOVE.Close();
-}
+/*
+main.cpp -  main file of the columbia optimizer
+$Revision: 27 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "cat.h"
+#include "cm.h"
+#include "tasks.h"
+#include "physop.h"
+#include "greedy.h"
+#include "bound.h"
+#include "topk.h"
+#include "exec.h"
+#include "plan.h"
+#include "whatif.h"
+#include "advisor.h"
+
+#include "global.h"			// global variables
+
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+#define LINEWIDTH 256		// buffer length of one text line
+#define KEYWORD_NUMOFQRY "NumOfQuery:"
+#define KEYWORD_QUERY "Query:"
+#define KEYWORD_PIGGYBACK "PiggyBack"
+
+#ifdef _DEBUG
+	#define new DEBUG_NEW
+	 CMemoryState oldMemState, newMemState, diffMemState;
+#endif
+
+#ifdef _DEBUG
+//Rule Firing Statistics
+INT_ARRAY TopMatch;
+INT_ARRAY Bindings;
+INT_ARRAY Conditions;
+#endif
+
+
+/*************  THE QUERIES TO OPTIMIZE  ********************/
+// One query of the query file, or of a sequence of the batch query file
+class BATCH_QUERY
+{
+public:
+	CString	Text;		// the query expression, with its comment lines
+	int		QueryNo;	// number of the query in its sequence, from 0
+	int		NumQuery;	// number of queries in the sequence
+	bool	PiggyBack;	// is the sequence PiggyBacked?
+
+	BATCH_QUERY() : QueryNo(0), NumQuery(1), PiggyBack(false) {};
+};
+
+typedef CArray<BATCH_QUERY, BATCH_QUERY&> BATCH;
+
+// The single query case: the whole file is the query
+static void ReadQuery(CString QueryFile, BATCH & Queries)
+{
+	FILE *fp;
+	char TextLine[LINEWIDTH];
+	BATCH_QUERY Entry;
+
+	if((fp = fopen(QueryFile,"r"))==NULL)
+		OUTPUT_ERROR("can not open file 'query'!");
+	while (fgets(TextLine, LINEWIDTH, fp) != NULL)
+		Entry.Text += TextLine;
+	fclose(fp);
+
+	Queries.Add(Entry);
+}
+
+/*
+The batch query case.  The batch query file is a list of sequences, each
+starting with the line "NumOfQuery: n", which may be preceded by the line
+"PiggyBack".  A query of the sequence starts with the line "Entry: m" and
+ends at the next line with one of these keywords, or at the end of the file.
+Comment and blank lines are skipped.
+
+The queries of the file up to an error are read into Queries, the error
+is returned, to be reported once those have been optimized.  It is empty
+if there is none.
+*/
+static CString ReadBatch(CString BatchFile, BATCH & Queries)
+{
+	FILE *fp;		//for the batch query file
+	char TextLine[LINEWIDTH]; // text line buffer
+	char *p;
+	CString Error;
+
+	if((fp = fopen(BatchFile,"r"))==NULL)
+		OUTPUT_ERROR("can not open the file you chose in the option dialogue");
+
+	BATCH_QUERY Entry;		// the query being read
+	bool InQuery = false;	// is Entry being read?
+	bool InSequence = false;	// has the sequence of Entry started?
+	bool PiggyBack = false;
+	int NumQuery = 0;		// number of queries of the sequence
+	int QueryNo = 0;		// number of queries of the sequence read so far
+	bool Empty = true;
+
+	while (fgets(TextLine, LINEWIDTH, fp) != NULL)
+	{
+		Empty = false;
+
+		// skip the comment line
+		if (IsCommentOrBlankLine(TextLine)) continue;
+
+		p = SkipSpace(TextLine);
+		bool NewQuery = (p == strstr(p, KEYWORD_QUERY));
+		bool NewSequence = (p == strstr(p, KEYWORD_NUMOFQRY) ||
+			p == strstr(p, KEYWORD_PIGGYBACK));
+
+		// the query being read ends at the next keyword
+		if (InQuery && (NewQuery || NewSequence))
+		{
+			Queries.Add(Entry);
+			InQuery = false;
+			if (++QueryNo == NumQuery) InSequence = false;
+		}
+
+		if (NewSequence)
+		{
+			if (InSequence)
+			{
+				Error = "the batch file has fewer queries than NumOfQuery says";
+				break;
+			}
+			if( p == strstr(p , KEYWORD_PIGGYBACK) )
+			{
+				PiggyBack = true;
+				continue;
+			}
+
+			p += strlen(KEYWORD_NUMOFQRY);
+			p = SkipSpace(p);
+			parseString(p);
+			NumQuery = atoi(p);
+			QueryNo = 0;
+			InSequence = (NumQuery > 0);
+			Entry.PiggyBack = PiggyBack;
+			PiggyBack = false;
+			continue;
+		}
+
+		if (!InSequence)
+		{
+			Error = "the first line in the batch file should be number of queries";
+			break;
+		}
+
+		// "Entry: m", or the first line of a query without it
+		if (!InQuery)
+		{
+			Entry.Text.Empty();
+			Entry.QueryNo = QueryNo;
+			Entry.NumQuery = NumQuery;
+			InQuery = true;
+		}
+		if (!NewQuery) Entry.Text += TextLine;
+	}
+	fclose(fp);
+
+	if (Empty) OUTPUT_ERROR("Empty Input File");
+	if (InQuery)
+	{
+		Queries.Add(Entry);
+		if (++QueryNo == NumQuery) InSequence = false;
+	}
+	if (InSequence && Error.IsEmpty())
+		Error = "the batch file has fewer queries than NumOfQuery says";
+
+	return Error;
+}
+
+
+/*************  CATALOG OF A QUERY  ********************/
+// A query adds its range variables to the catalog, so it is read anew for
+// each query, unless Serve() keeps one, which is reset after each query
+static void OpenCatalog()
+{
+	if (Ctx->KeptCat != NULL) Ctx->Cat = Ctx->KeptCat;
+	else Ctx->Cat = new CAT(CatFile);
+}
+
+static void CloseCatalog()
+{
+	if (Ctx->Cat == Ctx->KeptCat) Ctx->Cat->Reset();
+	else delete Ctx->Cat;
+}
+
+/*************  OPTIMIZE ONE QUERY  ********************/
+// The groups of SnapshotIn, read by LoadOptimizer(), NULL if there is none
+static ARCHIVE * Snapshot = NULL;
+// The candidate indexes of AdvisorFile, tried by each query, see Optimizer()
+static INDEX_ADVISOR * Advisor = NULL;
+
+// A new search space, made from the snapshot if there is one
+static SSP * NewSearchSpace()
+{
+	if (Snapshot == NULL) return new SSP;
+	TIMER Timer(T_COPY_IN);
+	ARCHIVE Ar(Snapshot->GetData(), Snapshot->GetSize());
+	return new SSP(Ar);
+}
+
+// Make the search space of Ctx->Query in Ctx->Ssp, with the joins in the
+// greedy order of GREEDY.  The search space of the query as it is written,
+// which gives the order, is not traced.
+static void FixJoinOrder()
+{
+	SSP * Ssp = Ctx->Ssp;
+	EXPR * Expr;
+	bool COVETrace = Ctx->COVETrace;
+	bool BinaryTrace = Ctx->BinaryTrace;
+
+	Ctx->COVETrace = Ctx->BinaryTrace = false;
+	Ctx->Ssp = new SSP;
+	Ctx->Ssp->Init();
+	{
+		GREEDY Plan;
+		Expr = Plan.GreedyExpr();
+	}
+	delete Ctx->Ssp;
+	Ctx->COVETrace = COVETrace;
+	Ctx->BinaryTrace = BinaryTrace;
+
+	Ctx->Ssp = Ssp;
+	Ctx->Ssp->Init(Expr);
+	delete Expr;
+	Ctx->FixedJoinOrder = true;
+}
+
+// Set the global epsilon bound to Eps times the cost of a greedy plan, and
+// bound the root context by the plan in the written order of the joins
+static void SeedGlobalEps(COST * HeuristicCost, double Eps)
+{
+	if (Ctx->vc.GetSize() == 0)
+	{
+		COST Infinite(-1);
+		Ctx->vc.Add(new CONT(new PHYS_PROP(any), Infinite, false));
+	}
+
+	double Written, Greedy;
+	Ctx->ForGlobalEpsPruning = true;
+	{
+		GREEDY Plan;
+		Written = Plan.WrittenCost();
+		Greedy = Plan.GreedyCost();
+	}
+	Ctx->ForGlobalEpsPruning = false;
+
+	*HeuristicCost = COST(Greedy == -1 ? Written : Greedy);
+	(*Ctx->GlobalEpsBound) = (*HeuristicCost) * Eps;
+
+	// the written plan is in the search space.  O_INPUTS prunes a plan
+	// costing as much as the bound, so it is raised a little.
+	if (Written != -1)
+	{
+		COST UpperBound(Written * (1 + 1e-6));
+		Ctx->vc[0]->SetUpperBound(UpperBound);
+	}
+}
+
+// Optimize BatchQuery, print its plan and statistics and add them to
+// QueryStats.  In PiggyBack mode the search space of the sequence is
+// created by its first query and kept, see Optimizer()
+static void OptimizeQuery(BATCH_QUERY & BatchQuery, COST * HeuristicCost)
+{
+	int q = BatchQuery.QueryNo;
+	int i;
+
+	// reset the interesting queries & M_WINNERs, clean the statistics.  A
+	// single query keeps the counts of the setup done by Optimizer().
+	if (RadioVal == 0)	//Batch case
+	{
+		Ctx->IntOrdersSet->reset();
+#ifdef IRPROP
+		//In PiggyBack mode remove the winners only when the first
+		//query in a batch is created,for the remaining queries read in keep
+		//the winners created for previous queries optimized
+		if ((PiggyBack && (0 == q)) || (!PiggyBack))
+		{Ctx->mc.RemoveAll();}
+
+#endif
+
+		for(i=0; i < CLASS_NUM; i++)
+			Ctx->ClassStat[i].Count = Ctx->ClassStat[i].Max = Ctx->ClassStat[i].Total = 0;
+		ResetTimers();
+		Ctx->OptStat->DupMExpr  = Ctx->OptStat->FiredRule  = Ctx->OptStat->HashedMExpr = 0;
+		Ctx->OptStat->MaxBucket = Ctx->OptStat->TotalMExpr = 0;
+#ifdef _DEBUG
+		for (int RuleNum = 0; RuleNum < Ctx->RuleSet->RuleCount; RuleNum++)
+		{
+			TopMatch[RuleNum] = 0;
+			Bindings[RuleNum] = 0;
+			Conditions[RuleNum] = 0;
+		}
+#endif
+		Ctx->TaskNo = 0;
+		Ctx->Memo_M_Exprs = 0;
+	}
+
+	//Print the number of the query
+#ifndef _TABLE_
+	if(SingleLineBatch)
+	{
+		OUTPUT("%d\t",q);	//First entry in output line in window
+	}
+	else
+		OUTPUT("Query: %d\r\n", q+1);	//In this case it's a full line
+#endif
+	if (Ctx->BinaryTrace) Ctx->TraceBuffer->NewQuery(q + 1);
+
+#ifdef _DEBUG
+	oldMemState.Checkpoint();
+#endif
+
+	//Since each optimization corrupts the catalog, we must create it anew
+	{
+		TIMER Timer(T_PARSE);
+		OpenCatalog();
+	}
+	PTRACE("Catalog content:\r\n%s", Ctx->Cat->Dump());
+
+#ifdef _TABLE_
+	assert(!SingleLineBatch);	//These are incompatible
+
+	//	Print Heading: EPS ...
+	OUTPUT("%s", "EPS, EPS_BD, CUREXPR, TOTEXPR, TASKS, OPTCOST\r\n");
+
+	// For each iteration of the global epsilon counter ii {
+	for (double ii = 0; ii <= GLOBAL_EPS*10; ii++)
+	{
+		OUTPUT("%3.1f\t", ii / 10 );
+		Ctx->ClassStat[C_M_EXPR].Count = Ctx->ClassStat[C_M_EXPR].Total = 0;
+#endif
+
+		//Parse and print the query and its interesting orders
+		{
+			TIMER Timer(T_PARSE);
+			Ctx->Query = new QUERY(BatchQuery.Text);
+		}
+		PTRACE("Original Query:\r\n%s", Ctx->Query->Dump());
+		PTRACE("The interesting orders in the query are:\r\n%s\n", Ctx->Query->Dump_IntOrders());
+
+		//Initialize and print the search space, delete the query
+		// In PiggyBack mode create the search space only for
+		// the first query(q == 0)and keep expanding it as more and
+		// more queries are read
+		//In non PiggyBack mode create a new search space(Ssp) for
+		//every query read because the search space for the previous
+		//query is deleted after it is optimized
+		if ((PiggyBack && (0 == q)) || (!PiggyBack))
+		{
+			Ctx->Ssp = NewSearchSpace();
+		}
+
+		// a join of too many tables is searched in a greedy order of its joins
+		if (!PiggyBack && FallbackTables > 0 &&
+			GREEDY::JoinSize(Ctx->Query->GetEXPR()) >= FallbackTables)
+		{
+#ifndef _TABLE_
+			if (!SingleLineBatch)
+				OUTPUT("Join of %d tables kept in a greedy order\r\n",
+					GREEDY::JoinSize(Ctx->Query->GetEXPR()));
+#endif
+			FixJoinOrder();
+		}
+		else
+			Ctx->Ssp->Init();
+		PTRACE("Initial Search Space:\r\n%s", Ctx->Ssp->Dump());
+		delete Ctx->Query;
+
+		//Keep track of initial space and time
+		PTRACE("---1--- memory statistics before optimization: %s", DumpStatistics());
+		PTRACE("used memory before opt: %dK\r\n",GetUsedMemory()/1000);
+		struct _timeb start, finish;
+		char *timeline;
+		_ftime( &start );
+		timeline = ctime(&(start.time));
+		CString tmpbuf;
+		tmpbuf.Format("%.8s.%0.3hu", &timeline[11], start.millitm);
+#ifndef _TABLE_
+		if(!SingleLineBatch)
+			OUTPUT("Optimization beginning time:\t\t%s (hr:min:sec.msec)\r\n", tmpbuf);
+#endif
+
+		ResetPeakMemory();
+		double StartMs = GetTimeMs();
+
+#ifdef _TABLE_
+		double Eps = ii / 10;
+#else
+		double Eps = GLOBAL_EPS;
+#endif
+		// if GlobepsPruning, a greedy plan gives the heuristic cost and the
+		// upper bound of the root context
+		if(Ctx->GlobepsPruning) SeedGlobalEps(HeuristicCost, Eps);
+
+		Ctx->MaxMExprs = (PiggyBack || Ctx->FixedJoinOrder) ? 0 : FallbackMExprs;
+		// a search which cannot be given up may still spill its cold groups
+		Ctx->SpillOnly = PiggyBack || Ctx->FixedJoinOrder;
+		Ctx->MemoryBudget = (Ctx->SpillOnly && SpillFile.IsEmpty()) ? 0 : MemoryBudget * 1048576.0;
+		if (!Ctx->Ssp->optimize())	//Later add an input condition so we can handle ORDER BY
+		{
+			// the search space grew too large, search again in the greedy
+			// order of the joins
+#ifndef _TABLE_
+			if (!SingleLineBatch)
+			{
+				if (Ctx->MaxMExprs > 0 && Ctx->ClassStat[C_M_EXPR].Count > Ctx->MaxMExprs)
+				{ OUTPUT("Search space over %d MExprs, joins kept in a greedy order\r\n", FallbackMExprs); }
+				else
+				{ OUTPUT("Search space over %dMB, joins kept in a greedy order\r\n", MemoryBudget); }
+			}
+#endif
+			Ctx->vc.RemoveAll();
+			delete Ctx->Ssp;
+			Ctx->Memo_M_Exprs = 0;
+			{
+				TIMER Timer(T_PARSE);
+				CloseCatalog();
+				OpenCatalog();
+				Ctx->Query = new QUERY(BatchQuery.Text);
+			}
+			if (Ctx->BinaryTrace) Ctx->TraceBuffer->NewQuery(q + 1);
+			Ctx->Ssp = new SSP;
+			FixJoinOrder();
+			delete Ctx->Query;
+
+			if(Ctx->GlobepsPruning) SeedGlobalEps(HeuristicCost, Eps);
+			Ctx->MaxMExprs = 0;
+			Ctx->SpillOnly = true;
+			if (SpillFile.IsEmpty()) Ctx->MemoryBudget = 0;
+			Ctx->Ssp->optimize();
+		}
+		// a search space whose joins were kept in order is not searched
+		// fully, so it is not written to a snapshot
+		bool Searched = !Ctx->FixedJoinOrder;
+		Ctx->FixedJoinOrder = false;
+
+		//Record the statistics of this query
+		QUERY_STAT Stat;
+		Stat.ElapsedMs		= GetTimeMs() - StartMs;
+		Stat.QueryNo		= q + 1;
+		Stat.TotalTask		= Ctx->TaskNo;
+		Stat.TotalGroup		= Ctx->ClassStat[C_GROUP].Count;
+		Stat.CurrentMExpr	= Ctx->ClassStat[C_M_EXPR].Count;
+		Stat.TotalMExpr		= Ctx->ClassStat[C_M_EXPR].Total;
+		Stat.MemoMExpr		= Ctx->Memo_M_Exprs;
+		Stat.DupMExpr		= Ctx->OptStat->DupMExpr;
+		Stat.HashedMExpr	= Ctx->OptStat->HashedMExpr;
+		Stat.MaxBucket		= Ctx->OptStat->MaxBucket;
+		Stat.FiredRule		= Ctx->OptStat->FiredRule;
+
+#ifndef _TABLE_
+		//OUTPUT elapsed time
+		long time;			//total seconds from start to finish
+		unsigned short msecs;	//milliseconds from start to finish
+		_ftime( &finish );
+		if (finish.millitm >= start.millitm)
+		{
+			time  = finish.time - start.time;
+			msecs = finish.millitm - start.millitm;
+		}
+		else
+		{
+			time  = finish.time - start.time - 1;
+			msecs = 1000 + finish.millitm - start.millitm;
+		}
+		long hrs, mins, secs;	// Print differences from start to finish
+		secs = time % 60;
+		mins = ((time - secs)/60) % 60;
+		hrs  = (time - secs - mins * 60) / 3600 ;
+		tmpbuf.Format("%0.2d:%0.2d:%0.2d.%0.3d\r\n", hrs, mins, secs, msecs);
+		if (!SingleLineBatch)
+		{
+			OUTPUT( "Optimization elapsed time:\t\t%s", tmpbuf);
+			OUTPUT("%s", "========  OPTIMAL PLAN =========\r\n");
+		}
+#endif
+
+
+		//CopyOut optimal plan. TRACE memory, search space.
+		PHYS_PROP * PhysProp = Ctx->vc[0]->GetPhysProp();
+		/* CopyOut the Optimal plan starting from the RootGID (the root group of
+		our Query )
+		*/
+		Ctx->OutputWindow->BeginCapture();
+		{
+			TIMER Timer(T_COPY_OUT);
+			PLAN * Plan = Ctx->Ssp->GetPlan(Ctx->Ssp->GetRootGID(), PhysProp);
+			Plan->CopyOut(0);
+			if (KeepPlans)
+			{
+				ARCHIVE Ar;
+				Plan->Store(Ar);
+				Stat.PlanJSON = Plan->DumpJSON();
+				Stat.PlanData = CString(Ar.GetData(), Ar.GetSize());
+			}
+			delete Plan;
+		}
+		Stat.Plan = Ctx->OutputWindow->EndCapture();
+#ifndef IRPROP
+		//CopyOut the next cheapest plans, see TOP_PLANS
+		if (TopPlans > 1 && !SingleLineBatch)
+		{
+			Ctx->OutputWindow->BeginCapture();
+			{
+				TIMER Timer(T_COPY_OUT);
+				TOP_PLANS Top(Ctx->Ssp->GetRootGID(), PhysProp, TopPlans, DistinctJoins);
+				// the first is the optimal plan
+				for (int i = 1; i < Top.GetSize(); i++)
+				{
+					CString os;
+					os.Format("========  PLAN %d, Cost = %s =========\r\n",
+						i + 1, COST(Top.GetCost(i)).Dump());
+					OUTPUT("%s", os);
+					Top.CopyOut(i);
+				}
+			}
+			Stat.Alternatives = Ctx->OutputWindow->EndCapture();
+		}
+		//Run the optimal plan, and the next cheapest, see EXEC
+		if (ExecScale > 0 && !SingleLineBatch)
+		{
+			Ctx->OutputWindow->BeginCapture();
+			{
+				TOP_PLANS Top(Ctx->Ssp->GetRootGID(), PhysProp, TopPlans, DistinctJoins);
+				EXEC Exec(ExecScale);
+				for (int i = 0; i < Top.GetSize(); i++) Exec.Execute(i + 1, Top.GetPlan(i));
+				if (Top.GetSize() == 0) OUTPUT("%s", "No complete plan to run\r\n");
+			}
+			Stat.Execution = Ctx->OutputWindow->EndCapture();
+		}
+#endif
+		for (int t = 0; t < TIMER_NUM; t++)
+			Stat.TimerMs[t] = Ctx->TimerStat[t].Total;
+		Stat.Cost = Ctx->Ssp->GetCost(Ctx->Ssp->GetRootGID(), PhysProp);
+		Stat.UsedMemory = GetUsedMemory();
+		Stat.PeakMemory = GetPeakMemory();
+		QueryStats.Add(Stat);
+		PTRACE("used memory after opt: %dK\r\n",GetUsedMemory() / 1000);
+		PTRACE("---2--- memory statistics after optimization: %s", DumpStatistics());
+		PTRACE("time statistics of the optimization: %s", DumpTimers());
+		if (Ctx->TraceFinalSSP) {
+			Ctx->Ssp->FastDump();
+		}
+		else {
+			PTRACE("final Search Space:\r\n%s", Ctx->Ssp->Dump());
+		}
+
+		if (!PiggyBack && !SnapshotOut.IsEmpty() && Searched) Ctx->Ssp->Save(SnapshotOut);
+
+		//Cost the search space again with the candidate indexes of the
+		//advisor, see INDEX_ADVISOR, which leaves it as it was, and with each
+		//change of WhatIfFile, see WHAT_IF.  The joins kept in order stay so,
+		//and the search is not given up.
+		if ((!WhatIfFile.IsEmpty() || Advisor != NULL) && !PiggyBack && !SingleLineBatch)
+		{
+			Ctx->FixedJoinOrder = !Searched;
+			Ctx->MaxMExprs = 0;
+			Ctx->MemoryBudget = 0;
+			Ctx->OutputWindow->BeginCapture();
+			if (Advisor != NULL) Advisor->Evaluate(q + 1);
+			if (!WhatIfFile.IsEmpty())
+			{
+				WHAT_IF WhatIf(WhatIfFile);
+				WhatIf.Run();
+			}
+			QueryStats[QueryStats.GetUpperBound()].WhatIf = Ctx->OutputWindow->EndCapture();
+			Ctx->FixedJoinOrder = false;
+		}
+
+		//Delete Contexts, delete search space
+		if(!PiggyBack)
+		{
+			Ctx->vc.RemoveAll();
+		}
+		PTRACE("used memory before deleting the search space: %dM\r\n", GetUsedMemory()/1000);
+		// Go on with the usual procedure of deleting the search space before
+		// optimizing the next query of the batch query file if not in the
+		// PiggyBack mode
+		// else keep the search space for reuse
+		if (!PiggyBack)
+		{
+			delete Ctx->Ssp;
+			Ctx->PropCache->Clear();
+		}
+		PTRACE("---3--- memory statistics after freeing searching space: %s", DumpStatistics());
+
+		//OUTPUT Rule Set Statistics
+#ifdef  _DEBUG
+#ifndef _TABLE_
+		if (!SingleLineBatch)
+			OUTPUT("%s",Ctx->RuleSet -> DumpStats());
+#endif
+#endif
+
+#ifdef _TABLE_
+	}
+#endif
+
+	//Report memory, delete catalog
+	PTRACE("used memory before deleting the catalog: %dM\r\n", GetUsedMemory()/1000);
+	CloseCatalog();
+}
+
+
+#ifndef _WIN32
+/*************  WORKERS OF A BATCH  ********************/
+/*
+The memory pools of USE_MEMORY_MANAGER are shared by all the contexts of a
+process, so the queries of a batch are optimized at once by worker
+processes, forked once the cost model and the rule set are loaded, each
+with its own catalog, search space, tasks, contexts and statistics.  Only the queries which are not PiggyBacked are
+handed out, one at a time, to the next idle worker.  A worker captures
+what it prints instead of writing it, and sends it back with the
+QUERY_STATs of the query.  The pool keeps them until Report() is called,
+so the queries are reported in their order in the batch.  When a worker
+stops, which OUTPUT_ERROR() does, its query is optimized again by the
+optimizer itself, to report the error as a run without workers does.
+*/
+class WORKER_POOL
+{
+private:
+	BATCH &	Queries;
+	COST *	HeuristicCost;
+	int		NextQuery;		// next query to hand out
+
+	// by worker
+	CArray<int, int> Pid;
+	CArray<int, int> ToWorker;	// pipe of the numbers of the queries, -1
+								// when the worker has stopped
+	CArray<int, int> FromWorker;	// pipe of the results
+	CArray<int, int> Busy;		// query being optimized, -1 if none
+
+	// by query
+	CArray<int, int> Done;		// 1 when the result has come, -1 when the
+								// worker has stopped on it
+	CArray<CString, CString&> Output;
+	CArray<CString, CString&> Stats;	// the QUERY_STATs, packed
+
+	void Work(int In, int Out);
+	void HandOut(int Worker);
+	void Receive(int Worker);
+
+public:
+	WORKER_POOL(BATCH & queries, COST * heuristicCost, int Jobs);
+	~WORKER_POOL();
+
+	// wait for the query Index of the batch, print it and add its statistics
+	// to QueryStats
+	void Report(int Index);
+}; // class WORKER_POOL
+
+static bool ReadAll(int fd, void * Buf, int Count)
+{
+	for (char * p = (char *)Buf; Count > 0; )
+	{
+		int n = read(fd, p, Count);
+		if (n <= 0) return false;
+		p += n;
+		Count -= n;
+	}
+	return true;
+}
+
+static void WriteAll(int fd, const void * Buf, int Count)
+{
+	for (const char * p = (const char *)Buf; Count > 0; )
+	{
+		int n = write(fd, p, Count);
+		if (n <= 0) _exit(1);	// the optimizer is gone
+		p += n;
+		Count -= n;
+	}
+}
+
+// A QUERY_STAT as it is sent by a worker: the numbers, then the plans
+static void PackStat(QUERY_STAT & Stat, CString & Buf)
+{
+	int Length = Stat.Plan.GetLength();
+	Buf += CString((const char *)&Stat.QueryNo, sizeof(int));
+	Buf += CString((const char *)&Stat.ElapsedMs, sizeof(double));
+	Buf += CString((const char *)&Stat.TotalTask, sizeof(int));
+	Buf += CString((const char *)&Stat.TotalGroup, sizeof(int));
+	Buf += CString((const char *)&Stat.CurrentMExpr, sizeof(int));
+	Buf += CString((const char *)&Stat.TotalMExpr, sizeof(int));
+	Buf += CString((const char *)&Stat.MemoMExpr, sizeof(int));
+	Buf += CString((const char *)&Stat.DupMExpr, sizeof(int));
+	Buf += CString((const char *)&Stat.HashedMExpr, sizeof(int));
+	Buf += CString((const char *)&Stat.MaxBucket, sizeof(int));
+	Buf += CString((const char *)&Stat.FiredRule, sizeof(int));
+	Buf += CString((const char *)&Stat.UsedMemory, sizeof(int));
+	Buf += CString((const char *)&Stat.PeakMemory, sizeof(int));
+	Buf += CString((const char *)&Stat.Cost, sizeof(double));
+	Buf += CString((const char *)Stat.TimerMs, sizeof(Stat.TimerMs));
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.Plan;
+	Length = Stat.Alternatives.GetLength();
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.Alternatives;
+	Length = Stat.Execution.GetLength();
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.Execution;
+	Length = Stat.PlanJSON.GetLength();
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.PlanJSON;
+	Length = Stat.PlanData.GetLength();
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.PlanData;
+	Length = Stat.WhatIf.GetLength();
+	Buf += CString((const char *)&Length, sizeof(int));
+	Buf += Stat.WhatIf;
+}
+
+static void UnpackStat(const char *& p, QUERY_STAT & Stat)
+{
+	int Length;
+	memcpy(&Stat.QueryNo, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.ElapsedMs, p, sizeof(double)); p += sizeof(double);
+	memcpy(&Stat.TotalTask, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.TotalGroup, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.CurrentMExpr, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.TotalMExpr, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.MemoMExpr, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.DupMExpr, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.HashedMExpr, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.MaxBucket, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.FiredRule, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.UsedMemory, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.PeakMemory, p, sizeof(int)); p += sizeof(int);
+	memcpy(&Stat.Cost, p, sizeof(double)); p += sizeof(double);
+	memcpy(Stat.TimerMs, p, sizeof(Stat.TimerMs)); p += sizeof(Stat.TimerMs);
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.Plan = CString(p, Length); p += Length;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.Alternatives = CString(p, Length); p += Length;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.Execution = CString(p, Length); p += Length;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.PlanJSON = CString(p, Length); p += Length;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.PlanData = CString(p, Length); p += Length;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Stat.WhatIf = CString(p, Length); p += Length;
+}
+
+WORKER_POOL::WORKER_POOL(BATCH & queries, COST * heuristicCost, int Jobs)
+	: Queries(queries), HeuristicCost(heuristicCost), NextQuery(0)
+{
+	Done.SetSize(Queries.GetSize());
+	Output.SetSize(Queries.GetSize());
+	Stats.SetSize(Queries.GetSize());
+	for (int q = 0; q < Queries.GetSize(); q++) Done[q] = 0;
+
+	// what is buffered would be written again by each worker
+	fflush(NULL);
+	Ctx->OutputFile.Flush();
+
+	for (int w = 0; w < Jobs; w++)
+	{
+		int ToPipe[2], FromPipe[2];
+		if (pipe(ToPipe) != 0 || pipe(FromPipe) != 0)
+			OUTPUT_ERROR("can not create the pipes of a worker");
+
+		int pid = fork();
+		if (pid < 0) OUTPUT_ERROR("can not start a worker");
+		if (pid == 0)
+		{
+			// the ends of the pipes of the earlier workers belong to the optimizer
+			for (int i = 0; i < w; i++)
+			{
+				close(ToWorker[i]);
+				close(FromWorker[i]);
+			}
+			close(ToPipe[1]);
+			close(FromPipe[0]);
+			Work(ToPipe[0], FromPipe[1]);
+			_exit(0);
+		}
+
+		close(ToPipe[0]);
+		close(FromPipe[1]);
+		Pid.Add(pid);
+		ToWorker.Add(ToPipe[1]);
+		FromWorker.Add(FromPipe[0]);
+		Busy.Add(-1);
+		HandOut(w);
+	}
+}
+
+WORKER_POOL::~WORKER_POOL()
+{
+	// a worker stops when its pipe is closed
+	for (int w = 0; w < Pid.GetSize(); w++)
+	{
+		if (ToWorker[w] != -1)
+		{
+			close(ToWorker[w]);
+			close(FromWorker[w]);
+		}
+		waitpid(Pid[w], NULL, 0);
+	}
+}
+
+// The worker: optimize each query it is sent, and send back the output,
+// and the statistics
+void WORKER_POOL::Work(int In, int Out)
+{
+	int Index;
+
+	Ctx->OutputWindow->SetOutput(NULL);
+	Ctx->OutputFile.Close();
+	Ctx->OutputCOVE.Close();
+	SnapshotOut.Empty();		// the queries of a worker are not the last ones
+
+	while (ReadAll(In, &Index, sizeof(int)))
+	{
+		Ctx->OutputWindow->BeginCapture();
+		QueryStats.RemoveAll();
+		OptimizeQuery(Queries[Index], HeuristicCost);
+		CString Result = Ctx->OutputWindow->EndCapture();
+
+		// the output, then the statistics
+		int Length = Result.GetLength();
+		CString Buf((const char *)&Length, sizeof(int));
+		Buf += Result;
+		Length = QueryStats.GetSize();
+		Buf += CString((const char *)&Length, sizeof(int));
+		for (int s = 0; s < QueryStats.GetSize(); s++) PackStat(QueryStats[s], Buf);
+
+		int Header[2] = { Index, Buf.GetLength() };
+		WriteAll(Out, Header, sizeof(Header));
+		WriteAll(Out, (LPCTSTR)Buf, Buf.GetLength());
+	}
+}
+
+// send the next query which is not PiggyBacked to an idle worker
+void WORKER_POOL::HandOut(int Worker)
+{
+	while (NextQuery < Queries.GetSize() && Queries[NextQuery].PiggyBack) NextQuery++;
+	if (NextQuery == Queries.GetSize() || ToWorker[Worker] == -1) return;
+
+	Busy[Worker] = NextQuery++;
+	if (write(ToWorker[Worker], &Busy[Worker], sizeof(int)) != sizeof(int))
+		OUTPUT_ERROR("can not send a query to a worker");
+}
+
+void WORKER_POOL::Receive(int Worker)
+{
+	int Header[2];
+	CString Buf;
+	if (!ReadAll(FromWorker[Worker], Header, sizeof(Header)) ||
+		!ReadAll(FromWorker[Worker], Buf.GetBufferSetLength(Header[1]), Header[1]))
+	{
+		// the worker has stopped
+		Done[Busy[Worker]] = -1;
+		Busy[Worker] = -1;
+		close(ToWorker[Worker]);
+		close(FromWorker[Worker]);
+		ToWorker[Worker] = -1;
+		return;
+	}
+
+	int Length;
+	const char * p = Buf;
+	memcpy(&Length, p, sizeof(int)); p += sizeof(int);
+	Output[Header[0]] = CString(p, Length);
+	Stats[Header[0]] = Buf.Mid(sizeof(int) + Length);
+	Done[Header[0]] = 1;
+
+	Busy[Worker] = -1;
+	HandOut(Worker);
+}
+
+void WORKER_POOL::Report(int Index)
+{
+	CArray<struct pollfd, struct pollfd&> Fds;
+	CArray<int, int> Workers;
+
+	while (!Done[Index])
+	{
+		Fds.RemoveAll();
+		Workers.RemoveAll();
+		for (int w = 0; w < Busy.GetSize(); w++)
+		{
+			if (Busy[w] == -1) continue;
+			struct pollfd Fd;
+			Fd.fd = FromWorker[w];
+			Fd.events = POLLIN;
+			Fd.revents = 0;
+			Fds.Add(Fd);
+			Workers.Add(w);
+		}
+		if (Fds.GetSize() == 0) break;	// all the workers have stopped
+
+		if (poll(Fds.GetData(), Fds.GetSize(), -1) < 0) continue;
+		for (int i = 0; i < Fds.GetSize(); i++)
+			if (Fds[i].revents) Receive(Workers[i]);
+	}
+	if (Done[Index] != 1)
+	{
+		OptimizeQuery(Queries[Index], HeuristicCost);
+		return;
+	}
+
+	Ctx->OutputWindow->Print(Output[Index]);
+	Ctx->OutputFile.Write(Output[Index], Output[Index].GetLength());
+	Output[Index].Empty();
+
+	int Count;
+	const char * p = Stats[Index];
+	memcpy(&Count, p, sizeof(int)); p += sizeof(int);
+	for (int s = 0; s < Count; s++)
+	{
+		QUERY_STAT Stat;
+		UnpackStat(p, Stat);
+		QueryStats.Add(Stat);
+	}
+	Stats[Index].Empty();
+}
+#endif //_WIN32
+
+
+/*************  LOAD THE OPTIMIZER  ********************/
+// Clean the statistics and create what is kept for all the queries: the
+// cost model, the rule set, the lower bounds and the heuristic cost, which
+// is returned
+static COST * LoadOptimizer()
+{
+	if(CatFile=="catalog") CatFile = AppDir + PATH_SEP "catalog";
+	if(CMFile=="cm") CMFile = AppDir + PATH_SEP "cm";
+	if(RSFile=="ruleset") RSFile = AppDir + PATH_SEP "ruleset";
+	QueryStats.RemoveAll();
+
+	// forget the interesting orders and winners of an earlier run
+	Ctx->IntOrdersSet->reset();
+#ifdef IRPROP
+	Ctx->mc.RemoveAll();
+#endif
+
+	// clean the statistics
+	int i;
+    for(i=0; i < CLASS_NUM; i++)
+    {
+		Ctx->ClassStat[i].Count = 0;
+		Ctx->ClassStat[i].Max = 0;
+		Ctx->ClassStat[i].Total = 0;
+    }
+	ResetTimers();
+
+#ifdef USE_MEMORY_MANAGER
+	// Pointer to global memory manager.
+	memory_manager = new MEMORY_MANAGER();
+#endif
+
+	// Create objects to manage Opt stats, Cost model, Rule set, Heuristic cost.
+	Ctx->OptStat = new OPT_STAT;
+	Ctx->Cm = new CM(CMFile);
+	PTRACE("cost model content:\r\n%s", Ctx->Cm->Dump());
+	Ctx->RuleSet = new RULE_SET(RSFile);
+	PTRACE("Rule set content:\r\n%s", Ctx->RuleSet->Dump());
+	Ctx->Bound = new LOWER_BOUND(LowerBounds);
+	PTRACE("Lower bounds: %s", Ctx->Bound->Dump());
+	COST *HeuristicCost;
+	HeuristicCost = new COST(0);
+
+	// The snapshot is made with the catalog, cost model and rule set just
+	// read.  Its groups are not in a COVE or binary trace.
+	if (!SnapshotIn.IsEmpty())
+	{
+		if (Ctx->COVETrace || Ctx->BinaryTrace)
+		{ OUTPUT("The snapshot %s is not used with a COVE or binary trace\r\n", SnapshotIn); }
+		else
+		{
+			Snapshot = new ARCHIVE;
+			if (!SSP::ReadSnapshot(SnapshotIn, *Snapshot))
+			{
+				delete Snapshot;
+				Snapshot = NULL;
+			}
+		}
+	}
+
+#ifdef _DEBUG
+	//Initialize Rule Firing Statistics
+	TopMatch.SetSize(Ctx->RuleSet->RuleCount);
+	Bindings.SetSize(Ctx->RuleSet->RuleCount);
+	Conditions.SetSize(Ctx->RuleSet->RuleCount);	//625
+	for (int RuleNum = 0; RuleNum < Ctx->RuleSet->RuleCount ; RuleNum++)
+	{
+		TopMatch[RuleNum] = 0;
+		Bindings[RuleNum] = 0;
+		Conditions[RuleNum] = 0;
+	}
+#endif
+
+	return HeuristicCost;
+}
+
+static void UnloadOptimizer(COST * HeuristicCost)
+{
+	//Free optimization stat object, cost model, rule set, bounds, heuristic cost
+	delete Ctx->OptStat;
+	delete Ctx->Cm;
+	delete Ctx->RuleSet;
+	delete Ctx->Bound;
+	delete (void*) HeuristicCost;
+	delete Snapshot;
+	Snapshot = NULL;
+
+#ifdef USE_MEMORY_MANAGER
+	PTRACE("used memory before delete manager: %dM\r\n", GetUsedMemory()/1000);
+	delete memory_manager ;
+
+#endif
+	PTRACE("used memory after delete manager: %dM\r\n", GetUsedMemory()/1000);
+
+#ifdef _DEBUG
+	newMemState.Checkpoint();
+	if (diffMemState.Difference(oldMemState, newMemState))
+	{
+		PTRACE("%s", "Memory leaked after optimizer!\n") ;
+		oldMemState.DumpAllObjectsSince();
+		diffMemState.DumpStatistics();
+	}
+#endif
+}
+
+
+/*************  DO THE OPTIMIZATION  ********************/
+void Optimizer()
+{
+	//Initialize
+	Ctx->TaskNo = 0;
+	Ctx->Memo_M_Exprs = 0;
+	SET_TRACE Trace(true);
+
+	//Open general trace file and COVE trace file, clear main output window
+	Ctx->OutputFile.Open( AppDir + PATH_SEP "colout.txt" , CFile::modeCreate | CFile::modeWrite );
+	Ctx->OutputCOVE.Open( AppDir + PATH_SEP "script.cove" , CFile::modeCreate | CFile::modeWrite );
+	if (Ctx->BinaryTrace) Ctx->TraceBuffer->Open( AppDir + PATH_SEP "trace.bin" );
+	Ctx->OutputWindow->ClearWindow();
+
+	COST * HeuristicCost = LoadOptimizer();
+	int i;
+
+	//SQueryFile, BQueryFile have been set to the Single or Batch Query File chosen in
+	//  the option dialog.  The default case is handled separately, with files
+	//  named query and bquery.  All the queries are read into Queries before
+	//  the first is optimized.
+	BATCH Queries;
+	CString BatchError;		// the error which ended the batch file, if any
+	if (RadioVal == 1)	// Single Query case
+	{
+		if(SQueryFile=="query") ReadQuery(AppDir + PATH_SEP "query", Queries);	//default case
+		else ReadQuery(SQueryFile, Queries);  //value entered in option dialog
+	}
+	else if (RadioVal == 0)	//Batch Query case
+	{
+		if(BQueryFile=="bquery") BQueryFile = AppDir + PATH_SEP "bquery";	//default case
+		BatchError = ReadBatch(BQueryFile, Queries);
+	}
+
+	if (!AdvisorFile.IsEmpty()) Advisor = new INDEX_ADVISOR(AdvisorFile);
+
+#ifndef _WIN32
+	// The queries which are not PiggyBacked go to the workers, when there is
+	// more than one of them.  A trace is written by one optimization at a
+	// time, and the advisor keeps the costs of every query.
+	WORKER_POOL * Pool = NULL;
+	int Parallel = 0;
+	for (int q = 0; q < Queries.GetSize(); q++)
+		if (!Queries[q].PiggyBack) Parallel++;
+	if (Jobs > 1 && Parallel > 1 && AdvisorFile.IsEmpty() &&
+		!Ctx->FileTrace && !Ctx->COVETrace && !Ctx->BinaryTrace &&
+		!Ctx->WindowTrace && !Ctx->TraceSSP && !Ctx->TraceOPEN && !Ctx->TraceFinalSSP)
+		Pool = new WORKER_POOL(Queries, HeuristicCost, Jobs < Parallel ? Jobs : Parallel);
+#endif
+
+	//The following loop is executed once for the single query case.
+	//For the batch case, it is executed once for each query of each
+	//batch query sequence. Executes batch of batches too.
+	for (int b = 0; b < Queries.GetSize(); b++)
+	{
+		BATCH_QUERY & BatchQuery = Queries[b];
+
+		if (BatchQuery.QueryNo == 0)
+		{
+			//Set the PiggyBack flag to be true if the batch
+			//query needs to be PiggyBacked,else the PiggyBack
+			//flag remains false.
+			PiggyBack = BatchQuery.PiggyBack;
+
+			//Header for single line batch output
+			if(SingleLineBatch)
+				OUTPUT("%s", "#\tTTask\tTGrp\tCME\tTME\tFR\tCOST\r\n");
+		}
+
+#ifndef _WIN32
+		if (Pool != NULL && !PiggyBack) Pool->Report(b);
+		else
+#endif
+		OptimizeQuery(BatchQuery, HeuristicCost);
+
+		if (RadioVal || BatchQuery.QueryNo < BatchQuery.NumQuery - 1)
+			continue;  //not the end of a sequence
+
+		OUTPUT("%s","\r\n");
+		OUTPUT("%s"," =============END OF A SEQUENCE================ ");
+		OUTPUT("%s","\r\n");
+
+		//this will be executed only if in PiggyBack mode
+		//to delete the search space one last time
+		if (PiggyBack)
+		{
+			if (!SnapshotOut.IsEmpty()) Ctx->Ssp->Save(SnapshotOut);
+			delete Ctx->Ssp;
+			Ctx->PropCache->Clear();
+			Ctx->vc.RemoveAll();
+		}
+	}	// end of loop over each query
+
+	if (Advisor != NULL)
+	{
+		Advisor->Recommend();
+		delete Advisor;
+		Advisor = NULL;
+	}
+#ifndef _WIN32
+	delete Pool;
+#endif
+	if (!BatchError.IsEmpty()) OUTPUT_ERROR(BatchError);
+
+	UnloadOptimizer(HeuristicCost);
+	Ctx->OutputFile.Close();
+	Ctx->OutputCOVE.Close();
+	Ctx->TraceBuffer->Close();
+}
+
+
+#ifndef _WIN32
+/*************  SERVE QUERIES  ********************/
+/*
+Serve() loads the cost model, the rule set and the catalog once, then
+optimizes the queries sent to the Unix domain socket SocketPath, one per
+connection.  The client writes the text of the query, as in a query file,
+and shuts down its side of the connection.  The server writes back what
+the optimizer prints for the query, or with JSON its QUERY_STAT as
+"colcmd -j" prints it, and closes the connection.  Nothing is written to
+colout.txt.  The catalog is reset after each query, see CAT::Mark().
+
+The queries are optimized by a child process, forked once all is loaded.
+OUTPUT_ERROR() stops it, after the error is written to the client (the
+reply is empty with JSON), and the server forks another one.
+*/
+static CString ServerSocket;	// removed when the server is stopped
+static int ServerPid = -1;		// the child process optimizing the queries
+
+static void StopServer(int Signal)
+{
+	if (ServerPid > 0) kill(ServerPid, SIGTERM);
+	unlink(ServerSocket);
+	_exit(0);
+}
+
+// The child process: optimize the query of each connection accepted on Listen
+static void ServeQueries(int Listen, bool JSON, COST * HeuristicCost)
+{
+	char Buf[4096];
+	int n;
+
+	for (;;)
+	{
+		int Conn = accept(Listen, NULL, NULL);
+		if (Conn < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED) continue;
+			_exit(1);
+		}
+
+		// the carriage returns are dropped, as fgets() does, see port.h
+		BATCH_QUERY Entry;
+		while ((n = read(Conn, Buf, sizeof(Buf))) > 0)
+			for (int i = 0; i < n; i++)
+				if (Buf[i] != '\r') Entry.Text += Buf[i];
+
+		FILE * Out = fdopen(Conn, "w");
+		Ctx->OutputWindow->SetOutput(JSON ? NULL : Out);
+		QueryStats.RemoveAll();
+		OptimizeQuery(Entry, HeuristicCost);
+		if (JSON) fprintf(Out, "%s\n", (LPCTSTR)QueryStats[0].DumpJSON());
+		fclose(Out);
+	}
+}
+
+void Serve(CString SocketPath, bool JSON)
+{
+	Ctx->TaskNo = 0;
+	Ctx->Memo_M_Exprs = 0;
+	RadioVal = 0;	// each query is a batch of its own
+
+	COST * HeuristicCost = LoadOptimizer();
+	Ctx->KeptCat = new CAT(CatFile);
+	Ctx->KeptCat->Mark();
+
+	struct sockaddr_un Addr;
+	memset(&Addr, 0, sizeof(Addr));
+	Addr.sun_family = AF_UNIX;
+	int Listen = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (Listen < 0 || SocketPath.GetLength() >= (int)sizeof(Addr.sun_path))
+		OUTPUT_ERROR("can not create the socket of the server");
+	strcpy(Addr.sun_path, SocketPath);
+	unlink(SocketPath);
+	if (bind(Listen, (struct sockaddr *)&Addr, sizeof(Addr)) != 0 || listen(Listen, 64) != 0)
+		OUTPUT_ERROR("can not listen on the socket of the server");
+
+	ServerSocket = SocketPath;
+	signal(SIGINT, StopServer);
+	signal(SIGTERM, StopServer);
+	signal(SIGPIPE, SIG_IGN);	// a client may go away before its reply
+	fflush(NULL);
+
+	for (;;)
+	{
+		ServerPid = fork();
+		if (ServerPid < 0) OUTPUT_ERROR("can not start the server");
+		if (ServerPid == 0)
+		{
+			signal(SIGINT, SIG_DFL);
+			signal(SIGTERM, SIG_DFL);
+			ServeQueries(Listen, JSON, HeuristicCost);
+		}
+
+		int Status;
+		while (waitpid(ServerPid, &Status, 0) < 0 && errno == EINTR) ;
+		fprintf(stderr, "a query stopped the optimizer, it is started again\n");
+	}
+}
+#endif //_WIN32
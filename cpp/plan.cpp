@@ -0,0 +1,241 @@
+/*
+plan.cpp -  implementation of the optimal plan of a query, as a tree
+$Revision: 1 $
+Implements classes in plan.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "plan.h"
+
+//=============  PLAN_PROP  ===================
+
+PLAN_PROP::PLAN_PROP(PHYS_PROP * Prop) : Order(Prop->GetOrder())
+{
+	if (Order == any) return;
+	KEYS_SET * KeysSet = Prop->GetKeysSet();
+	for (int i = 0; i < KeysSet->GetSize(); i++)
+	{
+		CString Name = GetAttName((*KeysSet)[i]);
+		Keys.Add(Name);
+	}
+	KeyOrder.Copy(Prop->KeyOrder);
+}
+
+PLAN_PROP::PLAN_PROP(PLAN_PROP & other) : Order(other.Order)
+{
+	Keys.Copy(other.Keys);
+	KeyOrder.Copy(other.KeyOrder);
+}
+
+CString PLAN_PROP::Dump()
+{
+	CString os;
+	int i;
+
+	if (Order == any) return "Any Prop";
+
+	os.Format("%s on (", Order == heap ? "heap" : Order == sorted ? "sorted"
+		: Order == hashed ? "hashed" : "UNKNOWN");
+	for (i = 0; i < Keys.GetSize(); i++)
+		os += Keys[i] + (i < Keys.GetSize() - 1 ? "," : "");
+	os += ")";
+	if (Order == sorted)
+	{
+		os += "  KeyOrder: (";
+		for (i = 0; i < KeyOrder.GetSize(); i++)
+		{
+			os += KeyOrder[i] == ascending ? "ascending" : "descending";
+			os += i < KeyOrder.GetSize() - 1 ? ", " : ")";
+		}
+	}
+	return os;
+}
+
+// the keys by name
+CString PLAN_PROP::DumpJSON()
+{
+	CString os;
+	int i;
+
+	if (Order == any) return "{\"order\": \"any\"}";
+
+	os.Format("{\"order\": \"%s\", \"keys\": [", OrderToString(Order));
+	for (i = 0; i < Keys.GetSize(); i++)
+		os += (i ? ", " : "") + JSONString(Keys[i]);
+	os += "]";
+	if (Order == sorted)
+	{
+		os += ", \"key_order\": [";
+		for (i = 0; i < KeyOrder.GetSize(); i++)
+		{
+			os += i ? ", " : "";
+			os += KeyOrder[i] == ascending ? "\"ascending\"" : "\"descending\"";
+		}
+		os += "]";
+	}
+	return os + "}";
+}
+
+void PLAN_PROP::Store(ARCHIVE & Ar)
+{
+	Ar << (int)Order << Keys.GetSize();
+	for (int i = 0; i < Keys.GetSize(); i++) Ar << Keys[i];
+	Ar << KeyOrder.GetSize();
+	for (int j = 0; j < KeyOrder.GetSize(); j++) Ar << (int)KeyOrder[j];
+}
+
+void PLAN_PROP::Load(ARCHIVE & Ar)
+{
+	int Value, Size;
+	Ar >> Value >> Size;
+	Order = (ORDER)Value;
+	Keys.SetSize(Size);
+	for (int i = 0; i < Size; i++) Ar >> Keys[i];
+	Ar >> Size;
+	KeyOrder.SetSize(Size);
+	for (int j = 0; j < Size; j++)
+	{
+		Ar >> Value;
+		KeyOrder[j] = (ORDER_AD)Value;
+	}
+}
+
+//=============  PLAN  ===================
+
+PLAN::~PLAN()
+{
+	delete Reqd;
+	delete Delivered;
+	for (int i = 0; i < Inputs.GetSize(); i++) delete Inputs[i];
+}
+
+void PLAN::CopyOut(int tabs)
+{
+	CString os;
+
+	if (!Found)
+	{
+		os.Format("No optimal plan for group: %d with phys_prop: %s\r\n", GrpID, Reqd->Dump());
+		OUTPUTN(tabs, os);
+		return;
+	}
+
+	if (IsConst)
+	{
+		os = Text + ", Cost = 0\r\n";
+		OUTPUTN(tabs, os);
+		return;
+	}
+
+	os = Text;
+	if (!IsItem && Name == "QSORT") os += Reqd->Dump();
+	os += ", Cost = ";
+
+#ifndef _TABLE_
+	if (IsItem || !SingleLineBatch)
+		OUTPUTN(tabs, os);
+	os.Format("%s\r\n", COST(Cost).Dump());
+	OUTPUT("%s", os);
+	//In this case we want only the total cost of the Winner
+	if (!IsItem && SingleLineBatch)
+	{
+		OUTPUT("%s", "\r\n");
+		return;
+	}
+#else
+	if (IsItem)
+	{
+		OUTPUTN(tabs, os);
+		os.Format("%s\r\n", COST(Cost).Dump());
+		OUTPUT("%s", os);
+	}
+	else
+	{
+		OUTPUT("\t%s\r\n", COST(Cost).Dump());
+		return;
+	}
+#endif
+
+	for (int i = 0; i < Inputs.GetSize(); i++) Inputs[i]->CopyOut(tabs + 1);
+}
+
+CString PLAN::DumpJSON()
+{
+	CString os, Temp;
+
+	Temp.Format("{\"group\": %d", GrpID);
+	os = Temp;
+	if (Reqd && (!Found || !IsItem)) os += ", \"required\": " + Reqd->DumpJSON();
+	if (!Found) return os + ", \"found\": false}";
+
+	os += ", \"op\": " + JSONString(Name) + ", \"text\": " + JSONString(Text);
+	Temp.Format(", \"kind\": \"%s\"", IsConst ? "const" : IsItem ? "item" : "physical");
+	os += Temp;
+	if (Delivered) os += ", \"delivered\": " + Delivered->DumpJSON();
+	if (Card >= 0)
+	{
+		Temp.Format(", \"card\": %g", Card);
+		os += Temp;
+	}
+	Temp.Format(", \"cost\": %g", Cost);
+	os += Temp;
+
+	if (Inputs.GetSize() > 0)
+	{
+		os += ", \"inputs\": [";
+		for (int i = 0; i < Inputs.GetSize(); i++)
+			os += (i ? ", " : "") + Inputs[i]->DumpJSON();
+		os += "]";
+	}
+	return os + "}";
+}
+
+void PLAN::Store(ARCHIVE & Ar)
+{
+	Ar << GrpID << (int)Found << (int)IsItem << (int)IsConst;
+	Ar << (int)(Reqd != NULL);
+	if (Reqd) Reqd->Store(Ar);
+	if (!Found) return;
+
+	Ar << Name << Text;
+	Ar << (int)(Delivered != NULL);
+	if (Delivered) Delivered->Store(Ar);
+	Ar << Card << Cost;
+	Ar << Inputs.GetSize();
+	for (int i = 0; i < Inputs.GetSize(); i++) Inputs[i]->Store(Ar);
+}
+
+PLAN * PLAN::Load(ARCHIVE & Ar)
+{
+	int GrpID, Found, IsItem, IsConst, Has, Arity;
+	Ar >> GrpID >> Found >> IsItem >> IsConst;
+	PLAN * Plan = new PLAN(GrpID, NULL);
+	Plan->Found = Found != 0;
+	Plan->IsItem = IsItem != 0;
+	Plan->IsConst = IsConst != 0;
+	Ar >> Has;
+	if (Has)
+	{
+		Plan->Reqd = new PLAN_PROP;
+		Plan->Reqd->Load(Ar);
+	}
+	if (!Plan->Found) return Plan;
+
+	Ar >> Plan->Name >> Plan->Text;
+	Ar >> Has;
+	if (Has)
+	{
+		Plan->Delivered = new PLAN_PROP;
+		Plan->Delivered->Load(Ar);
+	}
+	Ar >> Plan->Card >> Plan->Cost;
+	Ar >> Arity;
+	for (int i = 0; i < Arity; i++) Plan->Inputs.Add(PLAN::Load(Ar));
+	return Plan;
+}
@@ -0,0 +1,105 @@
+/*
+port.cpp -  implementation of the portability layer
+$Revision: 1 $
+Implements classes in port.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+
+#ifndef _WIN32
+
+//=============  CString Methods  ===================
+
+void CString::FormatV(const char * format, ...)
+{
+	char Buf[512];
+	va_list args;
+
+	va_start(args, format);
+	int Length = vsnprintf(Buf, sizeof(Buf), format, args);
+	va_end(args);
+
+	if (Length < 0) { Str.clear(); return; }
+	if (Length < (int)sizeof(Buf)) { Str.assign(Buf, Length); return; }
+
+	// did not fit, format again into a buffer of the right size
+	Str.resize(Length);
+	va_start(args, format);
+	vsnprintf(&Str[0], Length + 1, format, args);
+	va_end(args);
+}
+
+void CString::MakeUpper()
+{
+	for (int i = 0; i < GetLength(); i++) Str[i] = toupper(Str[i]);
+}
+
+void CString::MakeLower()
+{
+	for (int i = 0; i < GetLength(); i++) Str[i] = tolower(Str[i]);
+}
+
+void CString::TrimLeft()
+{
+	std::string::size_type p = Str.find_first_not_of(" \t\r\n");
+	Str.erase(0, p == std::string::npos ? Str.size() : p);
+}
+
+void CString::TrimRight()
+{
+	std::string::size_type p = Str.find_last_not_of(" \t\r\n");
+	Str.erase(p == std::string::npos ? 0 : p + 1);
+}
+
+char * CString::GetBuffer(int MinLength)
+{
+	// keep room for a terminating zero written by the caller
+	if (MinLength + 1 > GetLength()) Str.resize(MinLength + 1);
+	return &Str[0];
+}
+
+char * CString::GetBufferSetLength(int NewLength)
+{
+	Str.resize(NewLength);
+	return GetBuffer(NewLength);
+}
+
+void CString::ReleaseBuffer(int NewLength)
+{
+	if (NewLength == -1) NewLength = (int)strlen(Str.c_str());
+	Str.resize(NewLength);
+}
+
+//=============  CFile Methods  ===================
+
+BOOL CFile::Open(const char * FileName, UINT Flags)
+{
+	Close();
+
+	const char * Mode;
+	if (Flags & (modeWrite | modeReadWrite))
+	{
+		if ((Flags & modeCreate) && !(Flags & modeNoTruncate))
+			Mode = (Flags & modeReadWrite) ? "w+b" : "wb";
+		else
+			Mode = (Flags & modeReadWrite) ? "r+b" : "ab";
+	}
+	else Mode = "rb";
+
+	fp = fopen(FileName, Mode);
+	return fp != NULL;
+}
+
+void CFile::Close()
+{
+	if (fp) fclose(fp);
+	fp = NULL;
+}
+
+#endif //_WIN32
@@ -0,0 +1,137 @@
+/*
+spill.cpp -  implementation of the spill file
+$Revision: 1 $
+Implements classes in spill.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "spill.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+#define SPILL_START	(1 << 20)	// bytes of a new file
+#define SPILL_ALIGN	8			// records start at a multiple of this
+
+SPILL::SPILL() : Data(NULL), Capacity(0), Used(0), Records(0)
+{
+#ifdef _WIN32
+	File = Mapping = INVALID_HANDLE_VALUE;
+#else
+	File = -1;
+#endif
+}
+
+bool SPILL::Open(CString Name)
+{
+	Close();
+#ifdef _WIN32
+	FileName.Format("%s.%d", Name, (int)GetCurrentProcessId());
+	File = CreateFile(FileName, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+		FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+	if (File == INVALID_HANDLE_VALUE) return false;
+#else
+	FileName.Format("%s.%d", Name, (int)getpid());
+	File = open(FileName, O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if (File < 0) return false;
+	// the mapping keeps the file until it is closed
+	unlink(FileName);
+#endif
+	if (!Grow(SPILL_START))
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void SPILL::Close()
+{
+#ifdef _WIN32
+	if (Data) UnmapViewOfFile(Data);
+	if (Mapping != INVALID_HANDLE_VALUE) CloseHandle(Mapping);
+	if (File != INVALID_HANDLE_VALUE) CloseHandle(File);
+	File = Mapping = INVALID_HANDLE_VALUE;
+#else
+	if (Data) munmap(Data, Capacity);
+	if (File >= 0) close(File);
+	File = -1;
+#endif
+	Data = NULL;
+	Capacity = Used = 0;
+	Records = 0;
+}
+
+// The file at least doubles, and is mapped again.  If it cannot be, the
+// old mapping stays, with the records in it.
+bool SPILL::Grow(long Size)
+{
+	if (Used + Size <= Capacity) return true;
+	
+	long NewCapacity = Capacity ? Capacity : SPILL_START;
+	while (NewCapacity < Used + Size) NewCapacity *= 2;
+	
+#ifdef _WIN32
+	HANDLE NewMapping = CreateFileMapping(File, NULL, PAGE_READWRITE, 0, NewCapacity, NULL);
+	if (NewMapping == NULL) return false;
+	char * NewData = (char *)MapViewOfFile(NewMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (NewData == NULL)
+	{
+		CloseHandle(NewMapping);
+		return false;
+	}
+	if (Data) UnmapViewOfFile(Data);
+	if (Mapping != INVALID_HANDLE_VALUE) CloseHandle(Mapping);
+	Mapping = NewMapping;
+#else
+	if (ftruncate(File, NewCapacity) != 0) return false;
+	void * Map = mmap(NULL, NewCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, File, 0);
+	if (Map == MAP_FAILED) return false;
+	char * NewData = (char *)Map;
+	if (Data) munmap(Data, Capacity);
+#endif
+	Data = NewData;
+	Capacity = NewCapacity;
+	return true;
+}
+
+// A record is its size, then its bytes.  -1 if the file cannot grow.
+long SPILL::Put(ARCHIVE & Ar)
+{
+	int Size = Ar.GetSize();
+	long Length = (sizeof(int) + Size + SPILL_ALIGN - 1) & ~(long)(SPILL_ALIGN - 1);
+	if (!Grow(Length)) return -1;
+	
+	long Pos = Used;
+	memcpy(Data + Pos, &Size, sizeof(int));
+	memcpy(Data + Pos + sizeof(int), Ar.GetData(), Size);
+	Used += Length;
+	Records++;
+	return Pos;
+}
+
+const char * SPILL::Get(long Pos, int & Size)
+{
+	assert(Pos >= 0 && Pos < Used);
+	memcpy(&Size, Data + Pos, sizeof(int));
+	return Data + Pos + sizeof(int);
+}
+
+void SPILL::Free(long Pos)
+{
+	int Size;
+	memcpy(&Size, Data + Pos, sizeof(int));
+	long Length = (sizeof(int) + Size + SPILL_ALIGN - 1) & ~(long)(SPILL_ALIGN - 1);
+	
+	Records--;
+	if (Records == 0) Used = 0;
+	else if (Pos + Length == Used) Used = Pos;
+}
@@ -1,915 +1,1456 @@
-/*	
-ssp.cpp -  implementation of class SSP
-$Revision: 21 $ 
-Implements classes in ssp.h
-  
-Columbia Optimizer Framework
-  A Joint Research Project of Portland State University 
-  and the Oregon Graduate Institute
-  Directed by Leonard Shapiro and David Maier
-  Supported by NSF Grants IRI-9610013 and IRI-9619977
-  
-	
-*/
-
-/*  ssp.cpp -   search space implementation */
-
-#include "stdafx.h"
-#include "tasks.h"
-
-#ifdef _DEBUG
-	#define new DEBUG_NEW
-#endif
-
-#define SHRINK_INERVAL  10000
-#define MAX_AVAIL_MEM	40000000	// available memory bound to 50M
-
-extern COST GlobalEpsBound;
-
-//##ModelId=3B0C08650054
-SSP::SSP(): NewGrpID(-1)
-{
-	//initialize HashTbl to contain HashTableSize elements, each initially NULL.
-	HashTbl = new M_EXPR* [HtblSize];
-	for(ub4 i = 0 ; i < HtblSize ; i++)
-		HashTbl[i] = NULL;
-}
-
-//##ModelId=3B0C08650055
-void SSP::Init()
-{
-	EXPR *	Expr = Query->GetEXPR(); 
-    
-	// create the initial search space
-	RootGID = NEW_GRPID;
-	M_EXPR * MExpr = CopyIn( Expr, RootGID);
-    
-	InitGroupNum = NewGrpID;
-	if(COVETrace)	//End Initializing Search Space
-	{
-		CString os = "EndInit\r\n";
-		OutputCOVE.Write(os, os.GetLength());
-	}
-}
-
-// free up memory
-//##ModelId=3B0C0865005E
-SSP::~SSP()
-{
-	for(int i=0; i< Groups.GetSize();i++)
-		delete Groups[i] ;
-	for (int j=0; j< M_WINNER::mc.GetSize(); j++)
-		delete M_WINNER::mc[j];
-	M_WINNER::mc.RemoveAll();
-	delete [] HashTbl;
-}
-
-//##ModelId=3B0C086500EB
-CString SSP::DumpHashTable()
-{
-	CString os;
-	CString temp;
-    
-	os = "Hash Table BEGIN:\r\n";
-	int total=0;
-	for(int i=0; i < HtblSize; i++)
-	{
-		for(M_EXPR *mexpr = HashTbl[i]; mexpr != NULL; mexpr=mexpr->GetNextHash(),total++)
-			os += mexpr->Dump();
-		if(HashTbl[i]) os += "\r\n";
-	}
-	temp.Format("Hash Table END, total %d mexpr\r\n",total);
-	os += temp;
-    
-	return os;
-}
-
-//##ModelId=3B0C086500E2
-CString SSP::DumpChanged()
-{
-    CString os;
-    GROUP* Group;
-    
-	for(int i=0; i< Groups.GetSize();i++)
-		if(Groups[i]->is_changed()) 
-		{
-			Group = Groups[i];
-			os += Group->Dump();
-			Group->set_changed(false);
-		}
-		
-		if(os!="") 	return ("Changed Search Space:\r\n" + os);
-		else return ("Search Space not changed");
-}
-
-//##ModelId=3B0C086500C3
-void SSP::Shrink()
-{
-	for(int i=InitGroupNum; i<Groups.GetSize();i++)	ShrinkGroup(i) ;
-}
-
-//##ModelId=3B0C086500B9
-void SSP::ShrinkGroup(GRP_ID group_no)
-{
-    GROUP* Group;
-    M_EXPR * mexpr;
-    M_EXPR * p;
-    M_EXPR * prev;
-    int DeleteCount=0;
-    
-	SET_TRACE Trace(true);
-    
-	Group = Groups[group_no];
-    
-	if( ! Group->is_optimized() && ! Group->is_explored() ) return ;   // may be pruned
-    
-	PTRACE("Shrinking group %d,", group_no);
-    
-	// Shrink the logical mexpr
-	// init the rule mark of the first mexpr to 0, means all rules are allowed
-	mexpr =  Group->GetFirstLogMExpr();
-	mexpr->set_rule_mask( 0 );
-    
-	// delete all the mexpr except the first initial one
-	mexpr = mexpr->GetNextMExpr();
-    
-	while( mexpr != NULL )
-	{
-		// maintain the hash link
-		// find my self in the appropriate hash bucket
-		ub4 hashval = mexpr->hash();
-		for ( p = HashTbl[ hashval ], prev = NULL;
-		p != mexpr;  
-    				prev = p, p = p -> GetNextHash()) ;
-					
-					assert(p==mexpr);
-					// link prev's next hash to next 
-					if(prev) 
-						prev->SetNextHash(mexpr->GetNextHash());
-					else
-						// the mexpr is the first in the bucket
-						HashTbl[ hashval ] = mexpr->GetNextHash();
-					
-					p = mexpr;
-					mexpr = mexpr->GetNextMExpr();
-					
-					delete p; 
-					DeleteCount ++;
-	}
-    
-	mexpr =  Group->GetFirstLogMExpr();
-	mexpr->SetNextMExpr( NULL );
-	// update the lastlogmexpr = firstlogmexpr;
-	Group->SetLastLogMExpr(mexpr);
-    
-	// Shrink the physcal mexpr
-	mexpr =  Group->GetFirstPhysMExpr();
-    
-	while( mexpr != NULL )
-	{
-		p = mexpr;
-		mexpr = mexpr->GetNextMExpr();
-		
-		delete p; 
-		DeleteCount ++;
-	}
-    
-	mexpr =  Group->GetFirstPhysMExpr();
-	mexpr->SetNextMExpr( NULL );
-	// update the lastlogmexpr = firstlogmexpr;
-	Group->SetLastPhysMExpr(mexpr);
-    
-	Group->set_changed(true);
-	Group->set_exploring(false);
-	
-	PTRACE("Deleted %d mexpr!\r\n", DeleteCount);
-}
-
-//##ModelId=3B0C086500D7
-CString SSP::Dump()
-{
-    CString os;
-    GROUP* Group;
-    
-	os.Format("%s%d%s","RootGID:" , RootGID , "\r\n");
-    
-	for(int i=0; i< Groups.GetSize();i++)
-	{
-		Group = Groups[i];
-		os += Group->Dump();
-		Group->set_changed(false);
-	}
-	
-	return os;
-}
-
-//##ModelId=3B0C086500E1
-void SSP::FastDump()
-{
-	TRACE_FILE("SSP Content: RootGID: %d\r\n" , RootGID);
-    
-	for(int i=0; i< Groups.GetSize();i++)
-	{
-		Groups[i]->FastDump() ;
-		Groups[i]->set_changed(false);
-	}
-}
-
-//##ModelId=3B0C086500A5
-M_EXPR * SSP::FindDup (M_EXPR & MExpr)
-{
-	int Arity = MExpr.GetArity();
-	
-	ub4 hashval = MExpr.hash ();
-	M_EXPR * prev = HashTbl[hashval];
-    
-	int BucketSize = 0;
-	if (!ForGlobalEpsPruning) OptStat->HashedMExpr ++;
-	// try all expressions in the appropriate hash bucket
-	for (M_EXPR * old = prev;  old != NULL;  prev = old, old = old -> GetNextHash(), BucketSize++ )
-	{
-		
-		int input_no;
-		
-		// See if they have the same arities
-		if (old -> GetArity() != Arity) {
-			goto not_a_duplicate;
-		}
-		
-		// finding yourself does not constitute a duplicate
-		// compare pointers to see if EXPR_LISTs are the same
-		if (old == &MExpr) {
-			goto not_a_duplicate;
-		}
-		
-		// compare the inputs
-		// Compare the actual group pointers for every input
-		for (input_no = Arity;  -- input_no >= 0;  ) 
-			if ( MExpr.GetInput(input_no) != old->GetInput(input_no) )
-			{
-				PTRACE("Different at input %d", input_no);
-				goto not_a_duplicate;
-			}
-			
-			// finally compare the Op
-			if( ! ( *(old->GetOp()) == MExpr.GetOp() ) ) 
-			{
-				PTRACE2("Different at Operator. %s : %s", old->Dump(), MExpr.Dump());
-                goto not_a_duplicate;
-            }
-			
-			// "expr" is a duplicate of "old"
-			return ( old );
-			
-not_a_duplicate :
-			continue;       // check next expression in hash bucket
-	} // try all expressions in the appropriate hash bucket
-    
-	// no duplicate, insert into HashTable
-	if(prev == NULL) 
-		HashTbl[hashval] = & MExpr;
-	else 
-		prev->SetNextHash( & MExpr );
-    
-	if (!ForGlobalEpsPruning)
-	{
-		if(OptStat->MaxBucket < BucketSize) OptStat->MaxBucket = BucketSize;
-	}
-    
-	return ( NULL );
-} // SSP::FindDup
-
-// merge two groups when duplicate found in these two groups
-// means they should be the same group
-// always merge bigger group_no group to smaller one.
-
-//##ModelId=3B0C086500AE
-GRP_ID SSP::MergeGroups(GRP_ID group_no1, GRP_ID group_no2)
-{
-    //M_EXPR * mexpr;
-    
-	GRP_ID ToGid = group_no1;
-	GRP_ID FromGid = group_no2;
-    
-	// always merge bigger group_no group to smaller one.
-	if( group_no1 > group_no2) 
-	{
-		ToGid = group_no2;
-		FromGid = group_no1;
-	}
-    
-#ifdef UNIQ
-	assert(false);
-#endif
-    
-	return ToGid;
-}// SSP::MergeGroups
-
-
-//##ModelId=3B0C08650069
-M_EXPR*	SSP::CopyIn(EXPR * Expr, GRP_ID& GrpID)
-{
-	GROUP *	Group ;
-	bool win = true;	//will we initialize nontrivial winners in this group?
-	//False if it is a subgroup of a DUMMY operator
-    
-	//Factor GrpID value into normal value plus win value
-	if (GrpID == NEW_GRPID_NOWIN)
-	{
-		GrpID = NEW_GRPID;
-#ifdef DUMNOWIN
-		win = false;
-#endif
-	}
-	
-	// create the M_Expr which will reside in the group
-	M_EXPR * MExpr = new M_EXPR(Expr,GrpID);
-    
-	// find duplicate.  Done only for logical, not physical, expressions.
-	if(MExpr -> GetOp() -> is_logical()) {
-		M_EXPR * DupMExpr  = FindDup(*MExpr);
-		if( DupMExpr != NULL )		// not null ,there is a duplicate
-		{
-			if (!ForGlobalEpsPruning) OptStat->DupMExpr ++;		// calculate dup mexpr
-			PTRACE("duplicate mexpr : %s", MExpr->Dump());
-			
-			// the duplicate is in the group the expr wanted to copyin
-			if( GrpID == DupMExpr->GetGrpID() )
-			{	
-				delete MExpr;
-				return NULL;
-			}
-			
-			// If the Mexpr is supposed to be in a new group, set the group id 
-			if( GrpID == NEW_GRPID )
-			{
-				GrpID = DupMExpr->GetGrpID();
-				
-				// because the NewGrpID increases when constructing 
-				// an M_EXPR with NEW_GRPID, we need to decrease it
-				NewGrpID --;
-				
-				delete MExpr;
-				return NULL;
-			}
-			else
-			{
-				// otherwise, i.e., GrpID != DupMExpr->GrpID
-				// need do the merge
-				GrpID = MergeGroups(GrpID , DupMExpr->GetGrpID() );
-				delete MExpr;
-				return NULL;
-			}
-		}  // if( DupMExpr != NULL )
-	} //If the expression is logical
-	
-    
-	// no duplicate found
-	if(GrpID == NEW_GRPID)
-	{
-		// create a new group
-		Group = new GROUP( MExpr );
-		
-		// insert the new group into ssp
-		GrpID = Group->GetGroupID();
-		
-		if(GrpID >= Groups.GetSize() )	Groups.SetSize( GrpID + 1 );
-		Groups[GrpID] = Group;
-		
-		
-#ifdef IRPROP	
-		
-		// For the topmost group and for the groups containing the item operator and constant
-		// operator, set the only physical property as any and bound INF
-		if ( !win || GrpID == 0 || ((MExpr->GetOp())->is_const()) || 
-			((MExpr->GetOp())->is_item()) )
-		{
-			M_WINNER *MWin = new M_WINNER(1);
-			M_WINNER::mc.SetAtGrow(GrpID,MWin);
-		}
-		else
-		{
-			KEYS_SET * tmpKeySet;
-			
-			// get the relevant attributes from the schema for this group
-			tmpKeySet = (((LOG_COLL_PROP *)(Group->get_log_prop()))->Schema)->AttrStore();
-			int ksize = tmpKeySet->GetSize();
-			
-			M_WINNER *MWin = new M_WINNER(ksize+1);	
-			for (int i=1; i<ksize+1; i++)
-			{
-				int *Keys_Arr = tmpKeySet->CopyOutOne(i-1);
-				KEYS_SET *MKeys_Set = new KEYS_SET(Keys_Arr,1);
-				delete [] Keys_Arr;
-				
-				PHYS_PROP *Prop = new PHYS_PROP(MKeys_Set, sorted);
-				Prop->KeyOrder.Add(ascending);
-				MWin->SetPhysProp(i, Prop);
-			}
-			
-			delete tmpKeySet;
-			M_WINNER::mc.SetAtGrow(GrpID,MWin);
-		}
-#endif
-		
-	}
-	else 
-	{
-		Group = GetGroup(GrpID);
-		
-		// include the new MEXPR
-		Group->NewMExpr(MExpr);
-	}
-	// set the flag
-	Group->set_changed(true);
-    
-	return MExpr;
-    } // SSP::CopyIn
-    
-//##ModelId=3B0C0865007C
-    void SSP::CopyOut(GRP_ID GrpID, PHYS_PROP * PhysProp, int tabs)
-    { 
-		//Find the winner for this Physical Property.
-		//print the Winner's Operator and cost
-		GROUP * ThisGroup = Ssp -> GetGroup(GrpID);
-		
-#ifndef IRPROP
-		WINNER * ThisWinner;
-#endif
-		
-		M_EXPR * WinnerMExpr;
-		OP * WinnerOp ;
-		CString os;
-		
-		//special case : it's a const group
-		if( ThisGroup->GetFirstLogMExpr()->GetOp()->is_const() )
-		{
-#ifdef IRPROP		
-			WinnerMExpr = M_WINNER::mc[GrpID]->GetBPlan(PhysProp);
-#else
-			WinnerMExpr = ThisGroup->GetFirstLogMExpr();
-#endif
-			os = WinnerMExpr->GetOp()->Dump() ;
-			os += ", Cost = 0\r\n" ;
-			OUTPUTN(tabs, os); 
-		}
-		
-		//It's an item group
-		else if (ThisGroup->GetFirstLogMExpr()->GetOp()->is_item() )
-		{
-#ifdef IRPROP		
-			WinnerMExpr = M_WINNER::mc[GrpID]->GetBPlan(PhysProp);
-			if (WinnerMExpr == NULL)
-			{
-				os.Format("No optimal plan for group: %d with phys_prop: %s\r\n", GrpID, PhysProp->Dump());
-				OUTPUTN(tabs, os);
-				return;
-			}
-#else
-			ThisWinner = ThisGroup -> GetWinner(PhysProp);
-			
-			if( ThisWinner == NULL )  
-			{
-				os.Format("No optimal plan for group: %d with phys_prop: %s\r\n", GrpID, PhysProp->Dump());
-				OUTPUTN(tabs, os);
-				return;
-			}
-			
-			assert(ThisWinner->GetDone());
-			WinnerMExpr = ThisWinner -> GetMPlan();
-#endif
-			WinnerOp = WinnerMExpr -> GetOp();
-			
-			os.Format("%s", WinnerOp -> Dump());
-			
-			os += ", Cost = " ;
-			
-			OUTPUTN(tabs, os); 
-			
-#ifdef IRPROP
-			COST * WinnerCost = M_WINNER::mc[GrpID]->GetUpperBd(PhysProp);
-#else
-			COST * WinnerCost = ThisWinner -> GetCost();
-#endif
-			os.Format("%s\r\n", WinnerCost -> Dump() );
-			
-			OUTPUT("%s",os);
-			PHYS_PROP *InputProp;
-			//print the input recursively
-			for(int i = 0; i < WinnerMExpr -> GetArity(); i++) 
-			{
-				InputProp = new PHYS_PROP(any);
-				CopyOut(WinnerMExpr -> GetInput(i), InputProp, tabs+1);
-				delete InputProp;
-			}
-		}
-		
-		//it's a normal group
-		else
-		{
-			//First extract the winning expression for this property
-#ifndef IRPROP
-			ThisWinner = ThisGroup -> GetWinner(PhysProp);
-			
-			if( ThisWinner == NULL )  
-			{
-				os.Format("No optimal plan for group: %d with phys_prop: %s\r\n", GrpID, PhysProp->Dump());
-				OUTPUTN(tabs, os);
-				return;
-			}
-			
-			assert(ThisWinner->GetDone());
-			WinnerMExpr = ThisWinner -> GetMPlan();
-			
-#else
-			WinnerMExpr = M_WINNER::mc[GrpID]->GetBPlan(PhysProp);
-			if (WinnerMExpr == NULL)
-			{
-				os.Format("No optimal plan for group: %d with phys_prop: %s\r\n", GrpID, PhysProp->Dump());
-				OUTPUTN(tabs, os);
-				return;
-			}
-			
-#endif
-			
-			//Now extract the operator from the expression and write it to the output string
-			// along with   " cost = " .  Print output string to window.
-			assert (WinnerMExpr != NULL);
-			
-			WinnerOp = WinnerMExpr -> GetOp();
-			os.Format("%s", WinnerOp -> Dump());
-			if(WinnerOp->GetName()=="QSORT") os += PhysProp->Dump();
-			os += ", Cost = " ;
-			
-			
-#ifndef _TABLE_
-			if(!SingleLineBatch)
-				OUTPUTN(tabs, os); 
-#endif
-			
-			//Extract cost of the winner, write it to the output string and 
-			// print output string to window.
-#ifndef IRPROP
-			COST * WinnerCost = ThisWinner -> GetCost();
-#else
-			COST * WinnerCost = M_WINNER::mc[GrpID]->GetUpperBd(PhysProp);
-#endif
-			os.Format("%s\r\n", WinnerCost -> Dump() );
-			
-#ifndef _TABLE_
-			OUTPUT("%s",os);
-			if(SingleLineBatch)	//In this case we want only the total cost of the Winner
-			{
-				OUTPUT("%s","\r\n");
-				return;
-			}
-#else
-			OUTPUT("\t%s\r\n", WinnerCost -> Dump() );
-#endif
-			
-			
-			//Recursively print inputs
-#ifndef _TABLE_
-			int Arity = WinnerOp -> GetArity();
-			PHYS_PROP * ReqProp;
-			bool possible;
-			for(int i = 0; i < Arity ; i++) 
-			{
-				GRP_ID input_groupno = WinnerMExpr -> GetInput(i);
-				
-				ReqProp = ((PHYS_OP*)WinnerOp) -> InputReqdProp(PhysProp, 
-					Ssp->GetGroup(input_groupno)->get_log_prop(),
-					i, possible);
-				
-				assert(possible); //Otherwise optimization fails
-				
-				CopyOut(input_groupno, ReqProp, tabs+1);
-				
-				delete ReqProp ;  
-			}
-#endif
-		}
-    } //SSP::CopyOut()
-    
-#ifdef FIRSTPLAN
-//##ModelId=3B0C0867021A
-	bool GROUP::firstplan = false;
-#endif
-    
-    /* bool GROUP::search_circle(CONT * C, bool & moresearch) 
-    	{
-    		First search for a winner with property P.
-    		If there is no such winner, case (3)
-		If there is a winner, denote its plan component by WPlan and 
-			its cost component by WCost.
-			Context cost component is CCost
-    
-		If (WPlan is non-null) //Cheapest plan costs *WCost;
-                         //we seek a plan costing *CCost or less
-			If (*WCost <= *CCost) 
-    				Case (2)
-			else if (*CCost < *WCost)
-    				Case (1)
-		else If (WPlan is null) //All plans cost more than *WCost
-			if( *CCost <= *WCost)
-    				Case (1)
-			else if (*WCost < *CCost) //There might be a plan between WCost and CCost
-    				Case (4)
-    */
-    
-#ifdef IRPROP
-//##ModelId=3B0C08670095
-    bool GROUP::search_circle(int GrpNo, PHYS_PROP *PhysProp, bool & moreSearch)
-    {
-		// check if there is a winner for property "any"
-		M_EXPR *Winner = M_WINNER::mc[GrpNo]->GetBPlan(0);
-		if (Winner == NULL)
-			moreSearch = true;	// group is not optimized, moreSearch needed
-		else
-			moreSearch = false; // the group is completely optimized
-		
-		COST *CCost = new COST(-1);
-		if (!moreSearch) // group is optimized
-		{
-			M_EXPR *MWin = M_WINNER::mc[GrpNo]->GetBPlan(PhysProp);
-			COST *WinCost = M_WINNER::mc[GrpNo]->GetUpperBd(PhysProp);
-			if (MWin != NULL)
-			{
-				// winner's cost is within the context's bound
-				if (*CCost >= *WinCost)
-				{
-					delete CCost;
-					return true;
-				}
-				else
-				{
-					delete CCost;
-					return false;
-				}
-			}
-			else // since the group is optimized, NULL plan means winner not possible
-			{
-				delete CCost;
-				return false;
-			}
-		}
-		else // group not optimized 
-		{
-			delete CCost;
-			return false;
-		}
-    }
-#endif
-    
-	/* GROUP::search_circle
-	Map between four cases (see header file) and the way they arise:
-
-    No winner for this property:  (3)
-
-					WCost >= CCost	WCost < CCost	WCost <= CCost	WCost > CCost
-	
-	MPlan is Null			(1)			  (4)
-	
-	MPlan not Null										  (2)			  (1)
-
-    */
-//##ModelId=3B0C0867008B
-    bool GROUP::search_circle(CONT * C, bool & moreSearch)
-    {
-		//First search for a winner with property P.
-		WINNER * Winner = GetWinner(C -> GetPhysProp());
-		
-		//If there is no such winner, case (3)
-		if(!Winner) 
-		{
-			moreSearch = true;
-			return(false);
-		}
-		
-		assert(Winner->GetDone());	//This is not a recursive query
-		
-		//If there is a winner, denote its plan, cost components by M and WCost
-		//Context cost component is CCost
-		M_EXPR * M = Winner -> GetMPlan();
-		COST * WCost = Winner -> GetCost();
-		COST * CCost = C -> GetUpperBd();
-		assert(CCost);	//Did we get rid of all cruft?
-		
-		if (M)// there is a non-null winner
-		{
-			if(*CCost >= *WCost) //Real winner; CCost is less of a constraint.  Case (2)
-			{
-				moreSearch = false;
-				return(true);
-			}
-			else //search is impossible as winner's cost is more than required context cost (1)
-			{
-				moreSearch = false;
-				return(false);
-			}
-		}
-		else  //Winner's Mplan is null.
-		{
-			if( *WCost >= *CCost)  //Previous search failed and CCost is more of a constraint. (1)
-			{
-				moreSearch = false;
-				return(false);
-			}
-			else //Previous search failed but CCost is less of a constraint.  (4)
-			{
-				moreSearch = true;
-				return(true);
-			}
-		}
-    }
-    
-//##ModelId=3B0C086700A7
-    WINNER * GROUP::GetWinner(PHYS_PROP * PhysProp)
-    {
-		int Size = Winners.GetSize();
-        for(int i = 0; i<Size; i++)
-		{
-			PHYS_PROP * WinPhysProp = Winners[i] -> GetPhysProp();
-			
-			if( *WinPhysProp == *PhysProp) return( Winners[i]);
-		}
-		
-        //No matching winner
-        return(NULL);
-		
-    } // GROUP::GetWinner
-    
-//##ModelId=3B0C086700B1
-    void GROUP::NewWinner(PHYS_PROP * ReqdProp, M_EXPR * MExpr, COST * TotalCost, 
-		bool done)
-    {
-		if(COVETrace && MExpr)	//New Winner
-		{
-			CString os;
-			os.Format("NewWin %d \"%s\"%s  { %d %d \"%s\" %s }\r\n",
-				MExpr -> GetGrpID(), ReqdProp -> Dump(), TotalCost -> Dump(),
-				MExpr -> GetGrpID(),int(MExpr), 
-				MExpr -> Dump(), done?"Done":"Not Done");
-			
-			OutputCOVE.Write(os, os.GetLength());
-			
-		}
-		
-		this -> set_changed(true);
-		
-		//Seek winner with property ReqdProp in the winner's circle
-        for(int i = Winners.GetSize(); --i>=0;)
-		{
-			if( *(Winners[i] -> GetPhysProp()) == *ReqdProp) 
-			{
-				//Update the winner for the new search just begun
-				delete Winners[i];
-				Winners[i] = new WINNER(MExpr, ReqdProp, TotalCost, done);
-				return;
-			}
-		}
-		
-		//No matching winner for this property
-		Winners . Add(new WINNER(MExpr, ReqdProp, TotalCost, done));
-		
-		return;
-    }
-    
-//##ModelId=3B0C086700C6
-    bool GROUP::CheckWinnerDone()
-    {
-		//Search Winner's circle.  If there is a winner done, return true
-		
-		int Size = Winners.GetSize();
-		
-		for(int i = 0; i<Size; i++)
-		{
-			if (Winners[i] -> GetDone() ) return (true);
-		}
-		
-		//No winner is done
-		return(false);
-    } // GROUP::CheckWinnerDone
-    
-	
-//##ModelId=3B0C086703BE
-    WINNER::WINNER(M_EXPR *MExpr, PHYS_PROP *PhysProp, COST *Cost, bool done)
-		:Cost(Cost), 
-		MPlan( (MExpr==NULL) ? NULL : (new M_EXPR(*MExpr)) ), 
-		PhysProp(PhysProp),	
-		Done(done)
-    { if (TraceOn && !ForGlobalEpsPruning) ClassStat[C_WINNER].New(); };  
-    
-    
-//##ModelId=3B0C0868021B
-    M_WINNER::M_WINNER(int S)
-    {
-		if (TraceOn && !ForGlobalEpsPruning) ClassStat[C_M_WINNER].New();
-		
-		wide = S;
-		PhysProp = new PHYS_PROP* [S];
-		Bound = new COST* [S];
-		BPlan = new M_EXPR* [S];
-		
-		// set the first physical property as "any" for all groups
-		PhysProp[0] = new PHYS_PROP(any);
-		
-		// set the cost to INF and plan to NULL initially for all groups
-		for (int i=0; i<S; i++)
-		{
-			Bound[i] = new COST(-1);
-			BPlan[i] = NULL;
-		}
-    };
-    
-//##ModelId=3B0C08680192
-    CArray< M_WINNER * , M_WINNER* > M_WINNER::mc;
-//##ModelId=3B0C086801A4
-	COST M_WINNER::InfCost(-1);
-	
-	int TaskNo;
-	int Memo_M_Exprs;
-	
-//##ModelId=3B0C08650068
-    void SSP::optimize()
-    {
-#ifdef FIRSTPLAN
-		Ssp -> GetGroup(0) -> setfirstplan(false);
-#endif
-		
-		SET_TRACE Trace(true);
-		
-		//Create initial context, with no requested properties, infinite upper bound,
-		// zero lower bound, not yet done.  Later this may be specified by user.
-		if (CONT::vc.GetSize() == 0)
-		{
-			CONT * InitCont = new CONT( new PHYS_PROP(any), new COST(-1), false);
-			//Make this the first context
-			CONT::vc.Add (InitCont);
-		}
-		//assert(CONT::vc.GetSize() == 1);
-		
-		// start optimization with root group, 0th context, parent task of zero.  
-		if (GlobepsPruning)
-		{
-			COST * eps_bound = new COST(GlobalEpsBound);
-			PTasks.push (new O_GROUP (RootGID, 0, 0, true, eps_bound));
-		}
-		else
-			PTasks.push (new O_GROUP (RootGID, 0, 0));
-		
-		PTRACE ("initial OPEN:\r\n %s\r\n", PTasks.Dump() );
-		
-		// main loop of optimization
-		// while there are tasks undone, do one
-		while (! PTasks.empty ())
-		{
-			TaskNo ++;
-			PTRACE ("Starting task %d", TaskNo);
-			
-			TASK * NextTask = PTasks.pop ();
-			NextTask -> perform ();
-			
-			if(TraceSSP) 
-			{ 
-				TRACE_FILE("\r\n====== SSP after task %d: ", TaskNo);
-				TRACE_FILE ("%s\r\n", DumpChanged() ); 
-			}
-			else		 
-			{ PTRACE ("%s", DumpChanged() ); }
-			
-			if(TraceOPEN) 
-			{
-				TRACE_FILE("\r\n====== OPEN after task %d:\r\n", TaskNo);
-				TRACE_FILE("%s\r\n",PTasks.Dump());
-			}
-			else	
-			{	PTRACE2 ("OPEN after task %d:\r\n %s\r\n", TaskNo, PTasks.Dump() ); }
-		} // main optimization loop over remaining tasks in task list
-		
-		PTRACE ("Optimizing completed: %d tasks\r\n", TaskNo);
-#ifdef _TABLE_
-		OUTPUT("%s\t", GlobalEpsBound.Dump() );
-		OUTPUT("%d\t", ClassStat[C_M_EXPR].Count);
-		OUTPUT("%d\t", ClassStat[C_M_EXPR].Total);
-		OUTPUT("%d\t", TaskNo);
-#else
-		if(SingleLineBatch)
-		{
-			CString os;
-			os.Format("%d\t%d\t%d\t%d\t%d\t",TaskNo, ClassStat[C_GROUP].Count,
-				ClassStat[C_M_EXPR].Count, ClassStat[C_M_EXPR].Total,
-				OptStat -> FiredRule);
-			OUTPUT("%s",os);
-		}
-		else
-		{
-			OUTPUT("TotalTask : %d\r\n", TaskNo);
-			OUTPUT("TotalGroup : %d\r\n", ClassStat[C_GROUP].Count);
-			OUTPUT("CurrentMExpr : %d\r\n", ClassStat[C_M_EXPR].Count);
-			OUTPUT("TotalMExpr : %d\r\n", ClassStat[C_M_EXPR].Total);
-			OUTPUT("TotalMExpr in MEMO: %d\r\n", Memo_M_Exprs);
-			OUTPUT("%s", OptStat->Dump() );
-		}
-#endif
-    }  // SSP::optimize()
+/*	
+ssp.cpp -  implementation of class SSP
+$Revision: 21 $ 
+Implements classes in ssp.h
+  
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University 
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+  
+	
+*/
+
+/*  ssp.cpp -   search space implementation */
+
+#include "stdafx.h"
+#include "tasks.h"
+#include "spill.h"
+#include "cm.h"
+#include "plan.h"
+
+#ifdef _DEBUG
+	#define new DEBUG_NEW
+#endif
+
+#define SHRINK_INTERVAL	10000	// tasks between checks of the memory budget
+#define SHRINK_LEVEL	0.75	// shrink the search space over this part of it
+
+
+//##ModelId=3B0C08650054
+SSP::SSP(): NewGrpID(-1), Spill(NULL), NoSpill(false), SpillHead(NULL), FreeStub(-1)
+{
+	//initialize HashTbl to contain HashTableSize elements, each initially NULL.
+	HashTbl = new M_EXPR* [HtblSize];
+	for(ub4 i = 0 ; i < HtblSize ; i++)
+		HashTbl[i] = NULL;
+}
+
+//##ModelId=3B0C08650055
+void SSP::Init(EXPR * Expr)
+{
+	if (Expr == NULL) Expr = Ctx->Query->GetEXPR(); 
+    
+	// create the initial search space
+	RootGID = NEW_GRPID;
+	TIMER Timer(T_COPY_IN);
+	M_EXPR * MExpr = CopyIn( Expr, RootGID);
+    
+	InitGroupNum = NewGrpID;
+	if(Ctx->COVETrace)	//End Initializing Search Space
+	{
+		CString os = "EndInit\r\n";
+		Ctx->OutputCOVE.Write(os, os.GetLength());
+	}
+	if(Ctx->BinaryTrace) Ctx->TraceBuffer->EndInit();
+}
+
+// free up memory
+//##ModelId=3B0C0865005E
+SSP::~SSP()
+{
+	for(int i=0; i< Groups.GetSize();i++)
+		delete Groups[i] ;
+	for (int j=0; j< Ctx->mc.GetSize(); j++)
+		delete Ctx->mc[j];
+	Ctx->mc.RemoveAll();
+	delete [] HashTbl;
+	delete Spill;
+	delete [] SpillHead;
+}
+
+extern CString CatFile;		// the catalog a snapshot was made with, see Save()
+
+#define SNAPSHOT_MAGIC		0x50534C43	// "CLSP"
+#define SNAPSHOT_VERSION	2
+#define SNAPSHOT_HEADER		9			// ints before the groups, see Save()
+
+// The search space Store() wrote.  The logical mexprs go into HashTbl in
+// the order of their groups.
+SSP::SSP(ARCHIVE & Ar): NewGrpID(-1), Spill(NULL), NoSpill(false), SpillHead(NULL), FreeStub(-1)
+{
+	HashTbl = new M_EXPR* [HtblSize];
+	for(ub4 i = 0 ; i < HtblSize ; i++)
+		HashTbl[i] = NULL;
+	
+	int Size;
+	Ar >> RootGID >> InitGroupNum >> NewGrpID >> Size;
+	Groups.SetSize(Size);
+	for (int GrpID = 0; GrpID < Size; GrpID++)
+	{
+		int Present;
+		Ar >> Present;
+		Groups[GrpID] = NULL;
+		if (!Present) continue;
+		
+		GROUP * Group = new GROUP(Ar, GrpID);
+		Groups[GrpID] = Group;
+#ifdef IRPROP
+		Ctx->mc.SetAtGrow(GrpID, new M_WINNER(Ar, Group));
+#endif
+		for (M_EXPR * MExpr = Group->GetFirstLogMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		{
+			if (!MExpr->GetOp()->is_logical()) continue;
+			ub4 Bucket = MExpr->hash();
+			if (HashTbl[Bucket] == NULL) HashTbl[Bucket] = MExpr;
+			else
+			{
+				M_EXPR * Last = HashTbl[Bucket];
+				while (Last->GetNextHash() != NULL) Last = Last->GetNextHash();
+				Last->SetNextHash(MExpr);
+			}
+		}
+	}
+}
+
+// Spilled groups are read back to be written
+void SSP::Store(ARCHIVE & Ar)
+{
+	Ar << RootGID << InitGroupNum << NewGrpID << (int)Groups.GetSize();
+	for (int GrpID = 0; GrpID < Groups.GetSize(); GrpID++)
+	{
+		Ar << (int)(Groups[GrpID] != NULL);
+		if (Groups[GrpID] == NULL) continue;
+		
+		GROUP * Group = GetGroup(GrpID);
+		Group->Store(Ar);
+#ifdef IRPROP
+		Ctx->mc[GrpID]->Store(Ar, Group);
+#endif
+	}
+}
+
+static ub4 TextHash(CString Text)
+{
+	return lookup2(Text, Text.GetLength(), 0);
+}
+
+// the catalog is fingerprinted by its file, which has the statistics in full
+static ub4 FileHash(CString FileName)
+{
+	CString Text;
+	char Line[1024];
+	FILE * fp = fopen(FileName, "r");
+	if (fp == NULL) return 0;
+	while (fgets(Line, sizeof(Line), fp) != NULL) Text += Line;
+	fclose(fp);
+	return TextHash(Text);
+}
+
+// the options which change what the search finds
+static ub4 OptionsHash()
+{
+	CString Options;
+	Options.Format("%d %d %d %g %d %d", Pruning, CuCardPruning, Ctx->GlobepsPruning,
+		GLOBAL_EPS, Halt, TopPlans);
+	return TextHash(Options);
+}
+
+static ub4 Checksum(const char * Data, int Size)
+{
+	ub4 Sum = 0;
+	int i;
+	for (i = 0; i + 4 <= Size; i += 4)
+	{
+		unsigned int Word;
+		memcpy(&Word, Data + i, 4);
+		Sum = lookup2((ub4)Word, Sum);
+	}
+	for ( ; i < Size; i++) Sum = lookup2((ub4)(unsigned char)Data[i], Sum);
+	return Sum;
+}
+
+// The file starts with SNAPSHOT_HEADER ints: the magic number, the version,
+// whether IRPROP is defined, the fingerprints of the catalog, the cost model,
+// the rule set and the options, the size of the groups and their checksum.
+// It is written under another name first, so a reader never sees half of it.
+bool SSP::Save(CString FileName)
+{
+	ARCHIVE Payload;
+	Store(Payload);
+	
+	ARCHIVE Header;
+#ifdef IRPROP
+	int IrProp = 1;
+#else
+	int IrProp = 0;
+#endif
+	Header << SNAPSHOT_MAGIC << SNAPSHOT_VERSION << IrProp
+		<< (int)FileHash(CatFile) << (int)TextHash(Ctx->Cm->Dump())
+		<< (int)TextHash(Ctx->RuleSet->Dump()) << (int)OptionsHash()
+		<< Payload.GetSize() << (int)Checksum(Payload.GetData(), Payload.GetSize());
+	
+	CString TempName = FileName + ".tmp";
+	FILE * fp = fopen(TempName, "wb");
+	bool Ok = (fp != NULL);
+	if (Ok)
+	{
+		Ok = fwrite(Header.GetData(), 1, Header.GetSize(), fp) == (size_t)Header.GetSize()
+			&& fwrite(Payload.GetData(), 1, Payload.GetSize(), fp) == (size_t)Payload.GetSize();
+		Ok = (fclose(fp) == 0) && Ok;
+	}
+	if (Ok)
+	{
+		remove(FileName);
+		Ok = (rename(TempName, FileName) == 0);
+	}
+	if (!Ok)
+	{
+		remove(TempName);
+		OUTPUT("Cannot write the snapshot %s\r\n", FileName);
+	}
+	return Ok;
+}
+
+bool SSP::ReadSnapshot(CString FileName, ARCHIVE & Ar)
+{
+	int Header[SNAPSHOT_HEADER];
+	FILE * fp = fopen(FileName, "rb");
+	if (fp == NULL)
+	{
+		OUTPUT("Cannot read the snapshot %s\r\n", FileName);
+		return false;
+	}
+	if (fread(Header, sizeof(int), SNAPSHOT_HEADER, fp) != SNAPSHOT_HEADER
+		|| Header[0] != SNAPSHOT_MAGIC || Header[1] != SNAPSHOT_VERSION)
+	{
+		fclose(fp);
+		OUTPUT("%s is not a snapshot of this version\r\n", FileName);
+		return false;
+	}
+	
+#ifdef IRPROP
+	int IrProp = 1;
+#else
+	int IrProp = 0;
+#endif
+	CString Reason;
+	if (Header[2] != IrProp) Reason = "another build";
+	else if (Header[3] != (int)FileHash(CatFile)) Reason = "another catalog";
+	else if (Header[4] != (int)TextHash(Ctx->Cm->Dump())) Reason = "another cost model";
+	else if (Header[5] != (int)TextHash(Ctx->RuleSet->Dump())) Reason = "another rule set";
+	else if (Header[6] != (int)OptionsHash()) Reason = "other pruning options";
+	if (!Reason.IsEmpty())
+	{
+		CString Message;
+		Message.Format("The snapshot %s is not used, it was made with %s\r\n", FileName, Reason);
+		fclose(fp);
+		OUTPUT("%s", Message);
+		return false;
+	}
+	
+	int Size = Header[7];
+	char * Data = new char [Size > 0 ? Size : 1];
+	bool Ok = (Size >= 0 && fread(Data, 1, Size, fp) == (size_t)Size
+		&& Header[8] == (int)Checksum(Data, Size));
+	fclose(fp);
+	if (Ok) Ar.Write(Data, Size);
+	else OUTPUT("The snapshot %s is damaged\r\n", FileName);
+	delete [] Data;
+	return Ok;
+}
+
+//##ModelId=3B0C086500EB
+CString SSP::DumpHashTable()
+{
+	CString os;
+	CString temp;
+    
+	os = "Hash Table BEGIN:\r\n";
+	int total=0;
+	for(int i=0; i < HtblSize; i++)
+	{
+		for(M_EXPR *mexpr = HashTbl[i]; mexpr != NULL; mexpr=mexpr->GetNextHash(),total++)
+			os += mexpr->Dump();
+		if(HashTbl[i]) os += "\r\n";
+	}
+	temp.Format("Hash Table END, total %d mexpr\r\n",total);
+	os += temp;
+    
+	return os;
+}
+
+//##ModelId=3B0C086500E2
+CString SSP::DumpChanged()
+{
+    CString os;
+    GROUP* Group;
+    
+	for(int i=0; i< Groups.GetSize();i++)
+		if(Groups[i]->is_changed()) 
+		{
+			Group = Groups[i];
+			os += Group->Dump();
+			Group->set_changed(false);
+		}
+		
+		if(os!="") 	return ("Changed Search Space:\r\n" + os);
+		else return ("Search Space not changed");
+}
+
+//##ModelId=3B0C086500C3
+int SSP::Shrink()
+{
+	int DeleteCount = 0;
+#ifndef IRPROP
+	// the groups of the pending tasks are still being searched
+	int i;
+	CArray<int, int> Busy;
+	Busy.SetSize(Groups.GetSize());
+	for(i=0; i<Groups.GetSize();i++)	Busy[i] = 0;
+	Ctx->PTasks->MarkGroups(Busy);
+	
+	for(i=0; i<Groups.GetSize();i++)
+		if (!Busy[i]) DeleteCount += ShrinkGroup(i);
+#endif
+	// with IRPROP O_INPUTS deletes the physical mexprs which win no context
+	return DeleteCount;
+}
+
+// Only the physical mexprs are deleted.  The logical ones stay, they find
+// the duplicates of the expressions of the group.
+//##ModelId=3B0C086500B9
+int SSP::ShrinkGroup(GRP_ID group_no)
+{
+	int DeleteCount = 0;
+#ifndef IRPROP
+	SET_TRACE Trace(true);
+    
+	GROUP * Group = Groups[group_no];
+    
+	if( ! Group->is_optimized() ) return 0;   // still needs them
+    
+	DeleteCount = Group->DeleteLosers();
+	if (DeleteCount)
+		PTRACE2("Shrinking group %d, deleted %d mexpr\r\n", group_no, DeleteCount);
+#endif
+	return DeleteCount;
+}
+
+// The groups are spilled only when no trace refers to their mexprs by
+// address.  Item groups stay, they are small and their operators are not
+// written by LOG_OP::Store().
+int SSP::SpillCold()
+{
+	int SpillCount = 0;
+	int i;
+	if (SpillFile.IsEmpty() || NoSpill || Ctx->COVETrace || Ctx->BinaryTrace) return 0;
+	
+	if (Ctx->MemoBytes() > Ctx->MemoryBudget * SHRINK_LEVEL)
+	{
+		if (Spill == NULL)
+		{
+			Spill = new SPILL;
+			if (!Spill->Open(SpillFile))
+			{
+				OUTPUT("Cannot make the spill file %s\r\n", SpillFile);
+				delete Spill;
+				Spill = NULL;
+				NoSpill = true;
+				return 0;
+			}
+			SpillHead = new int [HtblSize];
+			for (ub4 b = 0; b < HtblSize; b++) SpillHead[b] = -1;
+		}
+		
+		CArray<int, int> Busy;
+		Busy.SetSize(Groups.GetSize());
+		for(i=0; i<Groups.GetSize();i++)	Busy[i] = 0;
+		Ctx->PTasks->MarkGroups(Busy);
+		
+		for(i=0; i<Groups.GetSize();i++)
+		{
+			GROUP * Group = Groups[i];
+			if (Busy[i] || Group->is_used() || Group->is_spilled() 
+				|| !Group->is_optimized()) continue;
+			OP * Op = Group->GetFirstLogMExpr()->GetOp();
+			if (Op->is_item() || Op->is_const()) continue;
+			if (SpillGroup(i)) SpillCount++;
+		}
+		PTRACE2("Spilled %d groups, %d bytes in the spill file\r\n", SpillCount, Spill->GetUsed());
+	}
+	
+	// the groups used from now on are hot at the next check
+	for(i=0; i<Groups.GetSize();i++)	Groups[i]->set_used(false);
+	return SpillCount;
+}
+
+// The mexprs leave HashTbl, and a stub in each bucket they were in
+bool SSP::SpillGroup(GRP_ID GrpID)
+{
+	GROUP * Group = Groups[GrpID];
+	
+	ARCHIVE Ar;
+	Group->StoreLogMExprs(Ar);
+	long Pos = Spill->Put(Ar);
+	if (Pos < 0) return false;		// the file cannot grow
+	Group->SetSpillPos(Pos);
+	
+	for (M_EXPR * MExpr = Group->GetFirstLogMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+	{
+		ub4 Bucket = MExpr->hash();
+		M_EXPR * Prev = NULL;
+		M_EXPR * Old = HashTbl[Bucket];
+		while (Old != MExpr)
+		{
+			Prev = Old;
+			Old = Old->GetNextHash();
+		}
+		if (Prev) Prev->SetNextHash(MExpr->GetNextHash());
+		else HashTbl[Bucket] = MExpr->GetNextHash();
+		AddStub(Bucket, GrpID);
+	}
+	Group->DeleteLogMExprs();
+	return true;
+}
+
+// The mexprs go back to the end of their buckets, as FindDup() would put them
+void SSP::FaultIn(GRP_ID GrpID)
+{
+	GROUP * Group = Groups[GrpID];
+	long Pos = Group->GetSpillPos();
+	int Size;
+	const char * Data = Spill->Get(Pos, Size);
+	
+	ARCHIVE Ar(Data, Size);
+	Group->LoadLogMExprs(Ar);
+	Spill->Free(Pos);
+	
+	for (M_EXPR * MExpr = Group->GetFirstLogMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+	{
+		ub4 Bucket = MExpr->hash();
+		RemoveStubs(Bucket, GrpID);
+		if (HashTbl[Bucket] == NULL) HashTbl[Bucket] = MExpr;
+		else
+		{
+			M_EXPR * Last = HashTbl[Bucket];
+			while (Last->GetNextHash() != NULL) Last = Last->GetNextHash();
+			Last->SetNextHash(MExpr);
+		}
+	}
+}
+
+// The spilled groups are read back first.  The contexts bound the
+// searches with the old costs, so they are deleted too.
+int SSP::Invalidate(CArray<int, int> & CollIds, bool CostModel, bool Stats)
+{
+	int Size = Groups.GetSize();
+	int GrpID, Count = 0;
+	CArray<int, int> Mark, Read;
+	Mark.SetSize(Size);
+	Read.SetSize(Size);
+	for (GrpID = 0; GrpID < Size; GrpID++)
+	{
+		Mark[GrpID] = 0;
+		Read[GrpID] = -1;
+		if (Groups[GrpID] != NULL) GetGroup(GrpID);
+	}
+	
+	for (GrpID = 0; GrpID < Size; GrpID++)
+	{
+		if (Groups[GrpID] == NULL) continue;
+		if (!Reads(GrpID, CollIds, Read) && !CostModel) continue;
+		Mark[GrpID] = 1;
+		Groups[GrpID]->Invalidate();
+		Count++;
+	}
+	
+	// the shared logical properties of the collections are stale
+	if (CollIds.GetSize() > 0 && Stats) Ctx->PropCache->Clear();
+	// Refresh() finds the logical properties of the groups read again
+	if (!Stats)
+		for (GrpID = 0; GrpID < Size; GrpID++) Read[GrpID] = 0;
+	for (GrpID = 0; GrpID < Size; GrpID++)
+		if (Groups[GrpID] != NULL) Refresh(GrpID, Mark, Read);
+	
+	// the root context keeps the property the query requires, as ORDER_BY
+	// sets it, with no bound
+	PHYS_PROP * RootProp = NULL;
+	if (Ctx->vc.GetSize() > 0 && Ctx->vc[0] != NULL)
+		RootProp = new PHYS_PROP(*Ctx->vc[0]->GetPhysProp());
+	Ctx->vc.RemoveAll();
+	if (RootProp != NULL)
+	{
+		COST Infinite(-1);
+		Ctx->vc.Add(new CONT(RootProp, Infinite, false));
+	}
+	PTRACE("%d groups invalidated\r\n", Count);
+	return Count;
+}
+
+// A group reads the collections its first logical mexpr reads, through
+// its inputs
+bool SSP::Reads(GRP_ID GrpID, CArray<int, int> & CollIds, CArray<int, int> & Read)
+{
+	if (Read[GrpID] >= 0) return Read[GrpID] != 0;
+	
+	M_EXPR * MExpr = Groups[GrpID]->GetFirstLogMExpr();
+	OP * Op = MExpr->GetOp();
+	bool Found = false;
+	if (Op->GetName().Compare("GET") == 0)
+		for (int i = 0; i < CollIds.GetSize(); i++)
+			if (CollIds[i] == ((GET *)Op)->GetCollection()) Found = true;
+	for (int j = 0; j < MExpr->GetArity(); j++)
+		if (Reads(MExpr->GetInput(j), CollIds, Read)) Found = true;
+	
+	Read[GrpID] = Found ? 1 : 0;
+	return Found;
+}
+
+// The bound of a group is found from those of the inputs of any of its
+// logical mexprs, see bound.h
+void SSP::Refresh(GRP_ID GrpID, CArray<int, int> & Mark, CArray<int, int> & Read)
+{
+	if (Mark[GrpID] != 1) return;
+	Mark[GrpID] = 2;
+	
+	GROUP * Group = Groups[GrpID];
+	for (M_EXPR * MExpr = Group->GetFirstLogMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr())
+		for (int i = 0; i < MExpr->GetArity(); i++)
+			Refresh(MExpr->GetInput(i), Mark, Read);
+	
+	if (Read[GrpID] == 1) Group->FindLogProp();
+	Group->FindLowerBd();
+}
+
+// One stub for each group with mexprs in the bucket
+void SSP::AddStub(ub4 Bucket, GRP_ID GrpID)
+{
+	int Stub;
+	for (Stub = SpillHead[Bucket]; Stub != -1; Stub = StubNext[Stub])
+		if (StubGroup[Stub] == GrpID) return;
+	
+	if (FreeStub != -1)
+	{
+		Stub = FreeStub;
+		FreeStub = StubNext[Stub];
+		StubGroup[Stub] = GrpID;
+		StubNext[Stub] = SpillHead[Bucket];
+	}
+	else
+	{
+		Stub = StubGroup.Add(GrpID);
+		StubNext.Add(SpillHead[Bucket]);
+	}
+	SpillHead[Bucket] = Stub;
+}
+
+void SSP::RemoveStubs(ub4 Bucket, GRP_ID GrpID)
+{
+	int Prev = -1;
+	int Stub = SpillHead[Bucket];
+	while (Stub != -1)
+	{
+		int Next = StubNext[Stub];
+		if (StubGroup[Stub] == GrpID)
+		{
+			if (Prev == -1) SpillHead[Bucket] = Next;
+			else StubNext[Prev] = Next;
+			StubNext[Stub] = FreeStub;
+			FreeStub = Stub;
+		}
+		else Prev = Stub;
+		Stub = Next;
+	}
+}
+
+//##ModelId=3B0C086500D7
+CString SSP::Dump()
+{
+    CString os;
+    GROUP* Group;
+    
+	os.Format("%s%d%s","RootGID:" , RootGID , "\r\n");
+    
+	for(int i=0; i< Groups.GetSize();i++)
+	{
+		Group = Groups[i];
+		os += Group->Dump();
+		Group->set_changed(false);
+	}
+	
+	return os;
+}
+
+//##ModelId=3B0C086500E1
+void SSP::FastDump()
+{
+	TRACE_FILE("SSP Content: RootGID: %d\r\n" , RootGID);
+    
+	for(int i=0; i< Groups.GetSize();i++)
+	{
+		Groups[i]->FastDump() ;
+		Groups[i]->set_changed(false);
+	}
+}
+
+//##ModelId=3B0C086500A5
+M_EXPR * SSP::FindDup (M_EXPR & MExpr)
+{
+	int Arity = MExpr.GetArity();
+	
+	ub4 hashval = MExpr.hash ();
+	
+	// the spilled mexprs of the bucket are compared too
+	if (SpillHead != NULL)
+		while (SpillHead[hashval] != -1) FaultIn(StubGroup[SpillHead[hashval]]);
+	
+	M_EXPR * prev = HashTbl[hashval];
+    
+	int BucketSize = 0;
+	if (!Ctx->ForGlobalEpsPruning) Ctx->OptStat->HashedMExpr ++;
+	// try all expressions in the appropriate hash bucket
+	for (M_EXPR * old = prev;  old != NULL;  prev = old, old = old -> GetNextHash(), BucketSize++ )
+	{
+		
+		int input_no;
+		
+		// See if they have the same arities
+		if (old -> GetArity() != Arity) {
+			goto not_a_duplicate;
+		}
+		
+		// finding yourself does not constitute a duplicate
+		// compare pointers to see if EXPR_LISTs are the same
+		if (old == &MExpr) {
+			goto not_a_duplicate;
+		}
+		
+		// compare the inputs
+		// Compare the actual group pointers for every input
+		for (input_no = Arity;  -- input_no >= 0;  ) 
+			if ( MExpr.GetInput(input_no) != old->GetInput(input_no) )
+			{
+				PTRACE("Different at input %d", input_no);
+				goto not_a_duplicate;
+			}
+			
+			// finally compare the Op
+			if( ! ( *(old->GetOp()) == MExpr.GetOp() ) ) 
+			{
+				PTRACE2("Different at Operator. %s : %s", old->Dump(), MExpr.Dump());
+                goto not_a_duplicate;
+            }
+			
+			// "expr" is a duplicate of "old"
+			return ( old );
+			
+not_a_duplicate :
+			continue;       // check next expression in hash bucket
+	} // try all expressions in the appropriate hash bucket
+    
+	// no duplicate, insert into HashTable
+	if(prev == NULL) 
+		HashTbl[hashval] = & MExpr;
+	else 
+		prev->SetNextHash( & MExpr );
+    
+	if (!Ctx->ForGlobalEpsPruning)
+	{
+		if(Ctx->OptStat->MaxBucket < BucketSize) Ctx->OptStat->MaxBucket = BucketSize;
+	}
+    
+	return ( NULL );
+} // SSP::FindDup
+
+// merge two groups when duplicate found in these two groups
+// means they should be the same group
+// always merge bigger group_no group to smaller one.
+
+//##ModelId=3B0C086500AE
+GRP_ID SSP::MergeGroups(GRP_ID group_no1, GRP_ID group_no2)
+{
+    //M_EXPR * mexpr;
+    
+	GRP_ID ToGid = group_no1;
+	GRP_ID FromGid = group_no2;
+    
+	// always merge bigger group_no group to smaller one.
+	if( group_no1 > group_no2) 
+	{
+		ToGid = group_no2;
+		FromGid = group_no1;
+	}
+    
+#ifdef UNIQ
+	assert(false);
+#endif
+    
+	return ToGid;
+}// SSP::MergeGroups
+
+
+//##ModelId=3B0C08650069
+M_EXPR*	SSP::CopyIn(EXPR * Expr, GRP_ID& GrpID)
+{
+	GROUP *	Group ;
+	bool win = true;	//will we initialize nontrivial winners in this group?
+	//False if it is a subgroup of a DUMMY operator
+    
+	//Factor GrpID value into normal value plus win value
+	if (GrpID == NEW_GRPID_NOWIN)
+	{
+		GrpID = NEW_GRPID;
+#ifdef DUMNOWIN
+		win = false;
+#endif
+	}
+	
+	// create the M_Expr which will reside in the group
+	M_EXPR * MExpr = new M_EXPR(Expr,GrpID);
+    
+	// find duplicate.  Done only for logical, not physical, expressions.
+	if(MExpr -> GetOp() -> is_logical()) {
+		M_EXPR * DupMExpr  = FindDup(*MExpr);
+		if( DupMExpr != NULL )		// not null ,there is a duplicate
+		{
+			if (!Ctx->ForGlobalEpsPruning) Ctx->OptStat->DupMExpr ++;		// calculate dup mexpr
+			PTRACE("duplicate mexpr : %s", MExpr->Dump());
+			
+			// the duplicate is in the group the expr wanted to copyin
+			if( GrpID == DupMExpr->GetGrpID() )
+			{	
+				delete MExpr;
+				return NULL;
+			}
+			
+			// If the Mexpr is supposed to be in a new group, set the group id 
+			if( GrpID == NEW_GRPID )
+			{
+				GrpID = DupMExpr->GetGrpID();
+				
+				// because the NewGrpID increases when constructing 
+				// an M_EXPR with NEW_GRPID, we need to decrease it
+				NewGrpID --;
+				
+				delete MExpr;
+				return NULL;
+			}
+			else
+			{
+				// otherwise, i.e., GrpID != DupMExpr->GrpID
+				// need do the merge
+				GrpID = MergeGroups(GrpID , DupMExpr->GetGrpID() );
+				delete MExpr;
+				return NULL;
+			}
+		}  // if( DupMExpr != NULL )
+	} //If the expression is logical
+	
+    
+	// no duplicate found
+	if(GrpID == NEW_GRPID)
+	{
+		// create a new group
+		Group = new GROUP( MExpr );
+		
+		// insert the new group into ssp
+		GrpID = Group->GetGroupID();
+		
+		if(GrpID >= Groups.GetSize() )	Groups.SetSize( GrpID + 1 );
+		Groups[GrpID] = Group;
+		
+		
+#ifdef IRPROP	
+		
+		// For the topmost group and for the groups containing the item operator and constant
+		// operator, set the only physical property as any and bound INF
+		if ( !win || GrpID == 0 || ((MExpr->GetOp())->is_const()) || 
+			((MExpr->GetOp())->is_item()) )
+		{
+			M_WINNER *MWin = new M_WINNER(1);
+			Ctx->mc.SetAtGrow(GrpID,MWin);
+		}
+		else
+		{
+			KEYS_SET * tmpKeySet;
+			
+			// get the relevant attributes from the schema for this group
+			tmpKeySet = (((LOG_COLL_PROP *)(Group->get_log_prop()))->Schema)->AttrStore();
+			int ksize = tmpKeySet->GetSize();
+			
+			M_WINNER *MWin = new M_WINNER(ksize+1);	
+			for (int i=1; i<ksize+1; i++)
+			{
+				int *Keys_Arr = tmpKeySet->CopyOutOne(i-1);
+				KEYS_SET *MKeys_Set = new KEYS_SET(Keys_Arr,1);
+				delete [] Keys_Arr;
+				
+				PHYS_PROP *Prop = new PHYS_PROP(MKeys_Set, sorted);
+				Prop->KeyOrder.Add(ascending);
+				MWin->SetPhysProp(i, Prop);
+			}
+			
+			delete tmpKeySet;
+			Ctx->mc.SetAtGrow(GrpID,MWin);
+		}
+#endif
+		
+	}
+	else 
+	{
+		Group = GetGroup(GrpID);
+		
+		// include the new MEXPR
+		Group->NewMExpr(MExpr);
+	}
+	// set the flag
+	Group->set_changed(true);
+    
+	return MExpr;
+    } // SSP::CopyIn
+    
+//##ModelId=3B0C0865007C
+    void SSP::CopyOut(GRP_ID GrpID, PHYS_PROP * PhysProp, int tabs)
+    { 
+		PLAN * Plan = GetPlan(GrpID, PhysProp);
+		Plan->CopyOut(tabs);
+		delete Plan;
+    } //SSP::CopyOut()
+    
+    PLAN * SSP::GetPlan(GRP_ID GrpID, PHYS_PROP * PhysProp)
+    { 
+		//Find the winner for this Physical Property.
+		GROUP * ThisGroup = Ctx->Ssp -> GetGroup(GrpID);
+		PLAN * Plan = new PLAN(GrpID, new PLAN_PROP(PhysProp));
+		
+#ifndef IRPROP
+		WINNER * ThisWinner;
+#endif
+		
+		M_EXPR * WinnerMExpr;
+		OP * WinnerOp ;
+		
+		//special case : it's a const group
+		if( ThisGroup->GetFirstLogMExpr()->GetOp()->is_const() )
+		{
+#ifdef IRPROP		
+			WinnerMExpr = Ctx->mc[GrpID]->GetBPlan(PhysProp);
+#else
+			WinnerMExpr = ThisGroup->GetFirstLogMExpr();
+#endif
+			Plan->Found = Plan->IsItem = Plan->IsConst = true;
+			Plan->Name = WinnerMExpr->GetOp()->GetName();
+			Plan->Text = WinnerMExpr->GetOp()->Dump();
+			return Plan;
+		}
+		
+		//First extract the winning expression for this property
+#ifdef IRPROP		
+		WinnerMExpr = Ctx->mc[GrpID]->GetBPlan(PhysProp);
+		if (WinnerMExpr == NULL) return Plan;
+		COST * WinnerCost = Ctx->mc[GrpID]->GetUpperBd(PhysProp);
+#else
+		ThisWinner = ThisGroup -> GetWinner(PhysProp);
+		
+		// no winner, or a winner without plan when the search failed
+		if( ThisWinner == NULL || ThisWinner -> GetMPlan() == NULL ) return Plan;
+		
+		assert(ThisWinner->GetDone());
+		WinnerMExpr = ThisWinner -> GetMPlan();
+		COST * WinnerCost = ThisWinner -> GetCost();
+#endif
+		
+		WinnerOp = WinnerMExpr -> GetOp();
+		Plan->Found = true;
+		Plan->Name = WinnerOp -> GetName();
+		Plan->Text = WinnerOp -> Dump();
+		Plan->Cost = WinnerCost -> GetValue();
+		
+		//It's an item group, its inputs are items with any property
+		if (ThisGroup->GetFirstLogMExpr()->GetOp()->is_item() )
+		{
+			Plan->IsItem = true;
+			PHYS_PROP Any(any);
+			for(int i = 0; i < WinnerMExpr -> GetArity(); i++) 
+				Plan->Inputs.Add(GetPlan(WinnerMExpr -> GetInput(i), &Any));
+			return Plan;
+		}
+		
+		//it's a normal group
+		Plan->Card = ((LOG_COLL_PROP *)ThisGroup->get_log_prop())->Card;
+		
+		//the inputs, with the properties the operator requires of them
+		int Arity = WinnerOp -> GetArity();
+		PHYS_PROP * ReqProp;
+		bool possible;
+		for(int i = 0; i < Arity ; i++) 
+		{
+			GRP_ID input_groupno = WinnerMExpr -> GetInput(i);
+			
+			ReqProp = ((PHYS_OP*)WinnerOp) -> InputReqdProp(PhysProp, 
+				Ctx->Ssp->GetGroup(input_groupno)->get_log_prop(),
+				i, possible);
+			
+			assert(possible); //Otherwise optimization fails
+			
+			Plan->Inputs.Add(GetPlan(input_groupno, ReqProp));
+			
+			delete ReqProp ;  
+		}
+		
+		//the property delivered, where the operator makes one
+		CString Name = Plan->Name;
+		if (Name == "FILE_SCAN" || Name == "MERGE_JOIN" || Name == "HGROUP_LIST")
+		{
+			PHYS_PROP * Delivered = ((PHYS_OP *)WinnerOp)->FindPhysProp();
+			Plan->Delivered = new PLAN_PROP(Delivered);
+			delete Delivered;
+		}
+		else if (Name == "BIT_JOIN" && Plan->Inputs[0]->Delivered)
+			Plan->Delivered = new PLAN_PROP(*Plan->Inputs[0]->Delivered);
+		else
+			Plan->Delivered = new PLAN_PROP(*Plan->Reqd);
+		
+		return Plan;
+    } //SSP::GetPlan()
+
+double SSP::GetCost(GRP_ID GrpID, PHYS_PROP * PhysProp)
+{
+#ifdef IRPROP
+	if (Ctx->mc[GrpID]->GetBPlan(PhysProp) != NULL)
+		return Ctx->mc[GrpID]->GetUpperBd(PhysProp)->GetValue();
+#else
+	WINNER * Winner = GetGroup(GrpID)->GetWinner(PhysProp);
+	if (Winner != NULL && Winner->GetMPlan() != NULL)
+		return Winner->GetCost()->GetValue();
+#endif
+	return -1;
+}
+    
+    
+    /* bool GROUP::search_circle(CONT * C, bool & moresearch) 
+    	{
+    		First search for a winner with property P.
+    		If there is no such winner, case (3)
+		If there is a winner, denote its plan component by WPlan and 
+			its cost component by WCost.
+			Context cost component is CCost
+    
+		If (WPlan is non-null) //Cheapest plan costs *WCost;
+                         //we seek a plan costing *CCost or less
+			If (*WCost <= *CCost) 
+    				Case (2)
+			else if (*CCost < *WCost)
+    				Case (1)
+		else If (WPlan is null) //All plans cost more than *WCost
+			if( *CCost <= *WCost)
+    				Case (1)
+			else if (*WCost < *CCost) //There might be a plan between WCost and CCost
+    				Case (4)
+    */
+    
+#ifdef IRPROP
+//##ModelId=3B0C08670095
+    bool GROUP::search_circle(int GrpNo, PHYS_PROP *PhysProp, bool & moreSearch)
+    {
+		// check if there is a winner for property "any"
+		M_EXPR *Winner = Ctx->mc[GrpNo]->GetBPlan(0);
+		if (Winner == NULL)
+			moreSearch = true;	// group is not optimized, moreSearch needed
+		else
+			moreSearch = false; // the group is completely optimized
+		
+		COST CCost(-1);
+		if (!moreSearch) // group is optimized
+		{
+			M_EXPR *MWin = Ctx->mc[GrpNo]->GetBPlan(PhysProp);
+			COST *WinCost = Ctx->mc[GrpNo]->GetUpperBd(PhysProp);
+			if (MWin != NULL)
+			{
+				// winner's cost is within the context's bound
+				if (CCost >= *WinCost)
+				{
+					return true;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else // since the group is optimized, NULL plan means winner not possible
+			{
+				return false;
+			}
+		}
+		else // group not optimized 
+		{
+			return false;
+		}
+    }
+#endif
+    
+	/* GROUP::search_circle
+	Map between four cases (see header file) and the way they arise:
+
+    No winner for this property:  (3)
+
+					WCost >= CCost	WCost < CCost	WCost <= CCost	WCost > CCost
+	
+	MPlan is Null			(1)			  (4)
+	
+	MPlan not Null										  (2)			  (1)
+
+    */
+//##ModelId=3B0C0867008B
+    bool GROUP::search_circle(CONT * C, bool & moreSearch)
+    {
+		//First search for a winner with property P.
+		WINNER * Winner = GetWinner(C -> GetPhysProp());
+		
+		//If there is no such winner, case (3)
+		if(!Winner) 
+		{
+			moreSearch = true;
+			return(false);
+		}
+		
+		assert(Winner->GetDone());	//This is not a recursive query
+		
+		//If there is a winner, denote its plan, cost components by M and WCost
+		//Context cost component is CCost
+		M_EXPR * M = Winner -> GetMPlan();
+		COST * WCost = Winner -> GetCost();
+		COST * CCost = C -> GetUpperBd();
+		assert(CCost);	//Did we get rid of all cruft?
+		
+		if (M)// there is a non-null winner
+		{
+			if(*CCost >= *WCost) //Real winner; CCost is less of a constraint.  Case (2)
+			{
+				moreSearch = false;
+				return(true);
+			}
+			else //search is impossible as winner's cost is more than required context cost (1)
+			{
+				moreSearch = false;
+				return(false);
+			}
+		}
+		else  //Winner's Mplan is null.
+		{
+			if( *WCost >= *CCost)  //Previous search failed and CCost is more of a constraint. (1)
+			{
+				moreSearch = false;
+				return(false);
+			}
+			else //Previous search failed but CCost is less of a constraint.  (4)
+			{
+				moreSearch = true;
+				return(true);
+			}
+		}
+    }
+    
+//##ModelId=3B0C086700A7
+    WINNER * GROUP::GetWinner(PHYS_PROP * PhysProp)
+    {
+		int Size = Winners.GetSize();
+        for(int i = 0; i<Size; i++)
+		{
+			PHYS_PROP * WinPhysProp = Winners[i] -> GetPhysProp();
+			
+			if( *WinPhysProp == *PhysProp) return( Winners[i]);
+		}
+		
+        //No matching winner
+        return(NULL);
+		
+    } // GROUP::GetWinner
+    
+    WINNER * GROUP::GetAnyWinner()
+    {
+		for(int i = 0; i < Winners.GetSize(); i++)
+			if (Winners[i] -> GetPhysProp() -> GetOrder() == any) return( Winners[i]);
+		
+        return(NULL);
+    } // GROUP::GetAnyWinner
+    
+//##ModelId=3B0C086700B1
+    void GROUP::NewWinner(PHYS_PROP * ReqdProp, M_EXPR * MExpr, COST * TotalCost, 
+		bool done)
+    {
+		if(Ctx->COVETrace && MExpr)	//New Winner
+		{
+			CString os;
+			os.Format("NewWin %d \"%s\"%s  { %d %d \"%s\" %s }\r\n",
+				MExpr -> GetGrpID(), ReqdProp -> Dump(), TotalCost -> Dump(),
+				MExpr -> GetGrpID(),int((size_t)MExpr), 
+				MExpr -> Dump(), done?"Done":"Not Done");
+			
+			Ctx->OutputCOVE.Write(os, os.GetLength());
+			
+		}
+		if(Ctx->BinaryTrace && MExpr) Ctx->TraceBuffer->NewWinner(MExpr, ReqdProp, TotalCost, done);
+		
+		this -> set_changed(true);
+		
+		//Seek winner with property ReqdProp in the winner's circle
+        for(int i = Winners.GetSize(); --i>=0;)
+		{
+			if( *(Winners[i] -> GetPhysProp()) == *ReqdProp) 
+			{
+				//Update the winner for the new search just begun
+				WINNER * Old = Winners[i];
+				Winners[i] = new WINNER(MExpr, ReqdProp, TotalCost, done);
+				// or for a cheaper plan of the search in progress, which keeps
+				// the plans found before
+				if (TopPlans > 1 && MExpr != NULL && !Old->GetDone())
+					Winners[i]->TakeOthers(Old);
+				delete Old;
+				return;
+			}
+		}
+		
+		//No matching winner for this property
+		Winners . Add(new WINNER(MExpr, ReqdProp, TotalCost, done));
+		
+		return;
+    }
+    
+//##ModelId=3B0C086700C6
+    bool GROUP::CheckWinnerDone()
+    {
+		//Search Winner's circle.  If there is a winner done, return true
+		
+		int Size = Winners.GetSize();
+		
+		for(int i = 0; i<Size; i++)
+		{
+			if (Winners[i] -> GetDone() ) return (true);
+		}
+		
+		//No winner is done
+		return(false);
+    } // GROUP::CheckWinnerDone
+    
+	
+//##ModelId=3B0C086703BE
+    WINNER::WINNER(M_EXPR *MExpr, PHYS_PROP *ReqdProp, COST *Cost, bool done)
+		:Cost(Cost), 
+		MPlan( (MExpr==NULL) ? NULL : (new M_EXPR(*MExpr)) ), 
+		PhysProp(new PHYS_PROP(*ReqdProp)),	
+		Done(done)
+    { if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_WINNER].New(); };  
+    
+    WINNER::WINNER(ARCHIVE & Ar, GRP_ID GrpID)
+		:MPlan(NULL), Cost(NULL)
+    {
+		int IsDone, HasPlan, HasCost;
+		Ar >> IsDone >> HasPlan >> HasCost;
+		Done = (IsDone != 0);
+		PhysProp = PHYS_PROP::Load(Ar);
+		if (HasPlan) MPlan = new M_EXPR(Ar, GrpID);
+		if (HasCost)
+		{
+			double Value;
+			Ar >> Value;
+			Cost = new COST(Value);
+		}
+		int OtherNum;
+		Ar >> OtherNum;
+		for (int i = 0; i < OtherNum; i++)
+		{
+			double Value;
+			Others.Add(new M_EXPR(Ar, GrpID));
+			Ar >> Value;
+			OtherCosts.Add(Value);
+		}
+		if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_WINNER].New();
+    }
+    
+    void WINNER::Store(ARCHIVE & Ar)
+    {
+		Ar << (int)Done << (int)(MPlan != NULL) << (int)(Cost != NULL);
+		PhysProp->Store(Ar);
+		if (MPlan != NULL) MPlan->Store(Ar);
+		if (Cost != NULL) Ar << Cost->GetValue();
+		Ar << Others.GetSize();
+		for (int i = 0; i < Others.GetSize(); i++)
+		{
+			Others[i]->Store(Ar);
+			Ar << OtherCosts[i];
+		}
+    }
+    
+    void WINNER::AddOther(M_EXPR * MExpr, double Cost)
+    {
+		// the same expression may be costed again in the search, by another
+		// firing of its rule
+		CString Name = MExpr->Dump();
+		if (MPlan != NULL && MPlan->Dump() == Name) return;
+		for (int j = 0; j < Others.GetSize(); j++)
+			if (Others[j]->Dump() == Name) return;
+		
+		int i = Others.GetSize();
+		while (i > 0 && OtherCosts[i - 1] > Cost) i--;
+		if (i >= TopPlans - 1) return;
+		
+		Others.InsertAt(i, new M_EXPR(*MExpr));
+		OtherCosts.InsertAt(i, Cost);
+		if (Others.GetSize() > TopPlans - 1)
+		{
+			delete Others[Others.GetUpperBound()];
+			Others.RemoveAt(Others.GetUpperBound());
+			OtherCosts.RemoveAt(OtherCosts.GetUpperBound());
+		}
+    }
+    
+    void WINNER::TakeOthers(WINNER * Old)
+    {
+		for (int i = 0; i < Others.GetSize(); i++) delete Others[i];
+		Others.RemoveAll();
+		OtherCosts.RemoveAll();
+		
+		// the old plan is the cheapest of the others, and the last of Old
+		// drops out when TopPlans are kept
+		if (Old->MPlan != NULL)
+		{
+			Others.Add(Old->MPlan);
+			OtherCosts.Add(Old->Cost->GetValue());
+			Old->MPlan = NULL;
+		}
+		for (int i = 0; i < Old->Others.GetSize(); i++)
+		{
+			if (Others.GetSize() < TopPlans - 1)
+			{
+				Others.Add(Old->Others[i]);
+				OtherCosts.Add(Old->OtherCosts[i]);
+			}
+			else delete Old->Others[i];
+		}
+		Old->Others.RemoveAll();
+		Old->OtherCosts.RemoveAll();
+    }
+    
+    COST WINNER::GetKeepBound()
+    {
+		if (MPlan == NULL || Others.GetSize() < TopPlans - 1) return COST(-1);
+		if (TopPlans == 1) return *Cost;
+		return COST(OtherCosts[OtherCosts.GetUpperBound()]);
+    }
+    
+    
+//##ModelId=3B0C0868021B
+    M_WINNER::M_WINNER(int S)
+    {
+		if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_M_WINNER].New();
+		
+		wide = S;
+		PhysProp = new PHYS_PROP* [S];
+		Bound = new COST* [S];
+		BPlan = new M_EXPR* [S];
+		
+		// set the first physical property as "any" for all groups
+		PhysProp[0] = new PHYS_PROP(any);
+		
+		// set the cost to INF and plan to NULL initially for all groups
+		for (int i=0; i<S; i++)
+		{
+			Bound[i] = new COST(-1);
+			BPlan[i] = NULL;
+		}
+    };
+    
+    // The plan of a multiwinner is a mexpr of its group: its place among the
+    // physical mexprs, or -2 less its place among the logical ones.  -1 for
+    // no plan.
+    static int PlanIndex(GROUP * Group, M_EXPR * Plan)
+    {
+		int i = 0;
+		M_EXPR * MExpr;
+		if (Plan == NULL) return -1;
+		for (MExpr = Group->GetFirstPhysMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr(), i++)
+			if (MExpr == Plan) return i;
+		i = 0;
+		for (MExpr = Group->GetFirstLogMExpr(); MExpr != NULL; MExpr = MExpr->GetNextMExpr(), i++)
+			if (MExpr == Plan) return -2 - i;
+		assert(false);
+		return -1;
+    }
+    
+    static M_EXPR * PlanAt(GROUP * Group, int Index)
+    {
+		M_EXPR * MExpr = NULL;
+		if (Index >= 0)
+			for (MExpr = Group->GetFirstPhysMExpr(); Index-- > 0; ) MExpr = MExpr->GetNextMExpr();
+		else if (Index <= -2)
+			for (MExpr = Group->GetFirstLogMExpr(); Index++ < -2; ) MExpr = MExpr->GetNextMExpr();
+		return MExpr;
+    }
+    
+    M_WINNER::M_WINNER(ARCHIVE & Ar, GROUP * Group)
+    {
+		if (!Ctx->ForGlobalEpsPruning) Ctx->ClassStat[C_M_WINNER].New();
+		
+		Ar >> wide;
+		PhysProp = new PHYS_PROP* [wide];
+		Bound = new COST* [wide];
+		BPlan = new M_EXPR* [wide];
+		for (int i=0; i<wide; i++)
+		{
+			int HasBound, Index;
+			double Value;
+			PhysProp[i] = PHYS_PROP::Load(Ar);
+			Ar >> HasBound;
+			Bound[i] = NULL;
+			if (HasBound)
+			{
+				Ar >> Value;
+				Bound[i] = new COST(Value);
+			}
+			Ar >> Index;
+			BPlan[i] = PlanAt(Group, Index);
+		}
+    }
+    
+    void M_WINNER::Store(ARCHIVE & Ar, GROUP * Group)
+    {
+		Ar << wide;
+		for (int i=0; i<wide; i++)
+		{
+			PhysProp[i]->Store(Ar);
+			Ar << (int)(Bound[i] != NULL);
+			if (Bound[i] != NULL) Ar << Bound[i]->GetValue();
+			Ar << PlanIndex(Group, BPlan[i]);
+		}
+    }
+    
+//##ModelId=3B0C086801A4
+	COST M_WINNER::InfCost(-1);
+	
+	
+//##ModelId=3B0C08650068
+    bool SSP::optimize()
+    {
+#ifdef FIRSTPLAN
+		Ctx->Ssp -> GetGroup(0) -> setfirstplan(false);
+#endif
+		
+		SET_TRACE Trace(true);
+		
+		//Create initial context, with no requested properties, infinite upper bound,
+		// zero lower bound, not yet done.  Later this may be specified by user.
+		if (Ctx->vc.GetSize() == 0)
+		{
+			COST Infinite(-1);
+			CONT * InitCont = new CONT( new PHYS_PROP(any), Infinite, false);
+			//Make this the first context
+			Ctx->vc.Add (InitCont);
+		}
+		//assert(CONT::vc.GetSize() == 1);
+		
+		// start optimization with root group, 0th context, parent task of zero.  
+		if (Ctx->GlobepsPruning)
+		{
+			COST * eps_bound = new COST((*Ctx->GlobalEpsBound));
+			Ctx->PTasks->push (new O_GROUP (RootGID, 0, 0, true, eps_bound));
+		}
+		else
+			Ctx->PTasks->push (new O_GROUP (RootGID, 0, 0));
+		
+		PTRACE ("initial OPEN:\r\n %s\r\n", Ctx->PTasks->Dump() );
+		
+		// main loop of optimization
+		// while there are tasks undone, do one
+		// The clock is read once per task, the time since the last reading
+		// goes to the timers of the task; perform() deletes the task.
+		double LastMs = GetTimeMs();
+		while (! Ctx->PTasks->empty ())
+		{
+			Ctx->TaskNo ++;
+			PTRACE ("Starting task %d", Ctx->TaskNo);
+			
+			TASK * NextTask = Ctx->PTasks->pop ();
+			TIMER_ID TaskTimer = NextTask -> GetTimerId ();
+			TIMER_ID PhaseTimer = NextTask -> GetPhaseTimerId ();
+			NextTask -> perform ();
+			
+			double NowMs = GetTimeMs();
+			if (!Ctx->ForGlobalEpsPruning)
+			{
+				Ctx->TimerStat[TaskTimer].Add(NowMs - LastMs);
+				if (PhaseTimer != TIMER_NUM) Ctx->TimerStat[PhaseTimer].Add(NowMs - LastMs);
+			}
+			LastMs = NowMs;
+			
+			// near the memory budget, spill the cold groups, then free the
+			// physical mexprs the optimized groups are done with
+			bool OverBudget = false;
+			if (Ctx->MemoryBudget > 0 && Ctx->TaskNo % SHRINK_INTERVAL == 0)
+			{
+				SpillCold();
+				if (!Ctx->SpillOnly && Ctx->MemoBytes() > Ctx->MemoryBudget * SHRINK_LEVEL)
+				{
+					PTRACE ("Shrinking the search space of %.0f bytes\r\n", Ctx->MemoBytes());
+					Shrink();
+					OverBudget = Ctx->MemoBytes() > Ctx->MemoryBudget;
+				}
+			}
+			
+			// the search space is too large, the caller searches again
+			// in a fixed join order
+			if (OverBudget ||
+				Ctx->MaxMExprs > 0 && Ctx->ClassStat[C_M_EXPR].Count > Ctx->MaxMExprs)
+			{
+				PTRACE ("Search given up after %d tasks\r\n", Ctx->TaskNo);
+				while (! Ctx->PTasks->empty ())
+					delete Ctx->PTasks->pop ();
+				return false;
+			}
+			
+			if(Ctx->TraceSSP) 
+			{ 
+				TRACE_FILE("\r\n====== SSP after task %d: ", Ctx->TaskNo);
+				TRACE_FILE ("%s\r\n", DumpChanged() ); 
+			}
+			else		 
+			{ PTRACE ("%s", DumpChanged() ); }
+			
+			if(Ctx->TraceOPEN) 
+			{
+				TRACE_FILE("\r\n====== OPEN after task %d:\r\n", Ctx->TaskNo);
+				TRACE_FILE("%s\r\n",Ctx->PTasks->Dump());
+			}
+			else	
+			{	PTRACE2 ("OPEN after task %d:\r\n %s\r\n", Ctx->TaskNo, Ctx->PTasks->Dump() ); }
+		} // main optimization loop over remaining tasks in task list
+		
+		PTRACE ("Optimizing completed: %d tasks\r\n", Ctx->TaskNo);
+#ifdef _TABLE_
+		OUTPUT("%s\t", Ctx->GlobalEpsBound->Dump() );
+		OUTPUT("%d\t", Ctx->ClassStat[C_M_EXPR].Count);
+		OUTPUT("%d\t", Ctx->ClassStat[C_M_EXPR].Total);
+		OUTPUT("%d\t", Ctx->TaskNo);
+#else
+		if(SingleLineBatch)
+		{
+			CString os;
+			os.Format("%d\t%d\t%d\t%d\t%d\t",Ctx->TaskNo, Ctx->ClassStat[C_GROUP].Count,
+				Ctx->ClassStat[C_M_EXPR].Count, Ctx->ClassStat[C_M_EXPR].Total,
+				Ctx->OptStat -> FiredRule);
+			OUTPUT("%s",os);
+		}
+		else
+		{
+			OUTPUT("TotalTask : %d\r\n", Ctx->TaskNo);
+			OUTPUT("TotalGroup : %d\r\n", Ctx->ClassStat[C_GROUP].Count);
+			OUTPUT("CurrentMExpr : %d\r\n", Ctx->ClassStat[C_M_EXPR].Count);
+			OUTPUT("TotalMExpr : %d\r\n", Ctx->ClassStat[C_M_EXPR].Total);
+			OUTPUT("TotalMExpr in MEMO: %d\r\n", Ctx->Memo_M_Exprs);
+			OUTPUT("%s", Ctx->OptStat->Dump() );
+		}
+#endif
+		return true;
+    }  // SSP::optimize()
@@ -1,6 +1,6 @@
-// stdafx.cpp : source file that includes just the standard includes
-//	wcol1.pch will be the pre-compiled header
-//	stdafx.obj will contain the pre-compiled type information
-
-#include "stdafx.h"
-
+// stdafx.cpp : source file that includes just the standard includes
+//	wcol1.pch will be the pre-compiled header
+//	stdafx.obj will contain the pre-compiled type information
+
+#include "stdafx.h"
+
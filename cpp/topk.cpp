@@ -0,0 +1,204 @@
+/*
+topk.cpp -  implementation of the cheapest complete plans of a query
+$Revision: 1 $
+Implements classes in topk.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "topk.h"
+#include "ssp.h"
+#include "physop.h"
+#include "item.h"
+
+PLAN_NODE::PLAN_NODE(GRP_ID grpID, M_EXPR * mexpr, PHYS_PROP * prop, double cost, int arity)
+	: GrpID(grpID), MExpr(mexpr), Prop(prop), Cost(cost), Arity(arity),
+	Inputs(arity ? new PLAN_NODE * [arity] : NULL)
+{
+	for (int i = 0; i < arity; i++) Inputs[i] = NULL;
+}
+
+TOP_PLANS::TOP_PLANS(GRP_ID GrpID, PHYS_PROP * Prop, int size, bool distinct)
+	: Size(size), Distinct(distinct)
+{
+	Root = Find(GrpID, Prop);
+}
+
+TOP_PLANS::~TOP_PLANS()
+{
+	for (int i = 0; i < Nodes.GetSize(); i++) delete Nodes[i];
+	for (int j = 0; j < Props.GetSize(); j++) delete Props[j];
+}
+
+PLAN_NODE * TOP_PLANS::NewNode(GRP_ID GrpID, M_EXPR * MExpr, PHYS_PROP * Prop,
+	double Cost, int Arity)
+{
+	PLAN_NODE * Node = new PLAN_NODE(GrpID, MExpr, Prop, Cost, Arity);
+	Nodes.Add(Node);
+	return Node;
+}
+
+void TOP_PLANS::Insert(PLAN_NODE * Node, CArray<PLAN_NODE *, PLAN_NODE *> & Best)
+{
+	int i = Best.GetSize();
+	while (i > 0 && Best[i - 1]->Cost > Node->Cost) i--;
+	if (i >= Size) return;
+
+	// a cheaper plan in the same join order leaves Node out, a dearer one
+	// is replaced by it
+	if (Distinct)
+	{
+		CString Join = GetJoins(Node);
+		for (int j = 0; j < Best.GetSize(); j++)
+			if (GetJoins(Best[j]) == Join)
+			{
+				if (j < i) return;
+				Best.RemoveAt(j);
+				break;
+			}
+	}
+
+	Best.InsertAt(i, Node);
+	if (Best.GetSize() > Size) Best.RemoveAt(Best.GetUpperBound());
+}
+
+int TOP_PLANS::Find(GRP_ID GrpID, PHYS_PROP * Prop)
+{
+	for (int k = 0; k < Groups.GetSize(); k++)
+		if (Groups[k] == GrpID && *Props[k] == *Prop) return k;
+
+	int k = Groups.Add(GrpID);
+	Props.Add(new PHYS_PROP(*Prop));
+	First.Add(0);
+	Count.Add(-1);
+
+	CArray<PLAN_NODE *, PLAN_NODE *> Best;
+	GROUP * Group = Ctx->Ssp->GetGroup(GrpID);
+	M_EXPR * FirstLogMExpr = Group->GetFirstLogMExpr();
+
+	// a const group has its constant as its only plan, see SSP::CopyOut()
+	if (FirstLogMExpr->GetOp()->is_const())
+	{
+		COST * Cost = ((CONST_OP *)FirstLogMExpr->GetOp())->get_cost();
+		Best.Add(NewNode(GrpID, FirstLogMExpr, Props[k], Cost->GetValue(), 0));
+	}
+	else
+	{
+		WINNER * Winner = Group->GetWinner(Props[k]);
+		if (Winner != NULL && Winner->GetMPlan() != NULL)
+		{
+			Combine(GrpID, Winner->GetMPlan(), Props[k], Best);
+			for (int i = 0; i < Winner->GetOtherNum(); i++)
+				Combine(GrpID, Winner->GetOther(i), Props[k], Best);
+		}
+	}
+
+	First[k] = Plans.GetSize();
+	Count[k] = Best.GetSize();
+	for (int i = 0; i < Best.GetSize(); i++) Plans.Add(Best[i]);
+	return k;
+}
+
+void TOP_PLANS::Combine(GRP_ID GrpID, M_EXPR * MExpr, PHYS_PROP * Prop,
+	CArray<PLAN_NODE *, PLAN_NODE *> & Best)
+{
+	OP * Op = MExpr->GetOp();
+	int Arity = MExpr->GetArity();
+
+	// the local cost, as O_INPUTS found it
+	LOG_PROP ** InputLogProp = new LOG_PROP * [Arity ? Arity : 1];
+	for (int i = 0; i < Arity; i++)
+		InputLogProp[i] = Ctx->Ssp->GetGroup(MExpr->GetInput(i))->get_log_prop();
+	double LocalCost = Op->FindLocalCost(Ctx->Ssp->GetGroup(GrpID)->get_log_prop(),
+		InputLogProp).GetValue();
+
+	// the cheapest plans with the inputs so far, the others still NULL
+	CArray<PLAN_NODE *, PLAN_NODE *> Partial;
+	Partial.Add(NewNode(GrpID, MExpr, Prop, LocalCost, Arity));
+
+	for (int i = 0; i < Arity && Partial.GetSize() > 0; i++)
+	{
+		PHYS_PROP * ReqProp;
+		bool possible = true;
+		if (Op->is_physical())
+			ReqProp = ((PHYS_OP *)Op)->InputReqdProp(Prop, InputLogProp[i], i, possible);
+		else
+			ReqProp = new PHYS_PROP(any);
+		int k = possible ? Find(MExpr->GetInput(i), ReqProp) : -1;
+		delete ReqProp;
+
+		CArray<PLAN_NODE *, PLAN_NODE *> Next;
+		if (k >= 0 && Count[k] > 0)
+			for (int p = 0; p < Partial.GetSize(); p++)
+				for (int q = 0; q < Count[k]; q++)
+				{
+					PLAN_NODE * Input = Plans[First[k] + q];
+					double Cost = Partial[p]->Cost + Input->Cost;
+					// the plans of the input are cheapest first
+					if (Next.GetSize() == Size && Cost >= Next[Size - 1]->Cost) break;
+
+					PLAN_NODE * Node = NewNode(GrpID, MExpr, Prop, Cost, Arity);
+					for (int j = 0; j < i; j++) Node->Inputs[j] = Partial[p]->Inputs[j];
+					Node->Inputs[i] = Input;
+					Insert(Node, Next);
+				}
+		Partial.RemoveAll();
+		Partial.Append(Next);
+	}
+	delete [] InputLogProp;
+
+	for (int p = 0; p < Partial.GetSize(); p++) Insert(Partial[p], Best);
+}
+
+void TOP_PLANS::CopyOut(PLAN_NODE * Node, int tabs)
+{
+	OP * Op = Node->MExpr->GetOp();
+	CString os;
+
+	if (Op->is_const())
+	{
+		os = Op->Dump();
+		os += ", Cost = 0\r\n";
+		OUTPUTN(tabs, os);
+		return;
+	}
+
+	os.Format("%s", Op->Dump());
+	if (!Op->is_item() && Op->GetName() == "QSORT") os += Node->Prop->Dump();
+	os += ", Cost = ";
+	OUTPUTN(tabs, os);
+	os.Format("%s\r\n", COST(Node->Cost).Dump());
+	OUTPUT("%s", os);
+
+	for (int i = 0; i < Node->Arity; i++) CopyOut(Node->Inputs[i], tabs + 1);
+}
+
+void TOP_PLANS::Joins(PLAN_NODE * Node, CArray<int, int> & Used)
+{
+	int i = 0;
+	while (i < Used.GetSize() && Used[i] < Node->GrpID) i++;
+	if (i == Used.GetSize() || Used[i] != Node->GrpID) Used.InsertAt(i, Node->GrpID);
+
+	// the inputs not combined yet are NULL
+	for (int j = 0; j < Node->Arity; j++)
+		if (Node->Inputs[j]) Joins(Node->Inputs[j], Used);
+}
+
+CString TOP_PLANS::GetJoins(PLAN_NODE * Node)
+{
+	CArray<int, int> Used;
+	Joins(Node, Used);
+
+	CString os, temp;
+	for (int j = 0; j < Used.GetSize(); j++)
+	{
+		temp.Format("%d ", Used[j]);
+		os += temp;
+	}
+	return os;
+}
@@ -0,0 +1,199 @@
+/*
+trace.cpp -  implementation of the binary trace
+$Revision: 1 $
+Implements classes in trace.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "tasks.h"
+
+#define TEXT_BUCKETS 4096	// buckets of the table of texts, a power of 2
+
+bool TRACE_BUFFER::Open(CString FileName, int size)
+{
+	Close();
+	if (!File.Open(FileName, CFile::modeCreate | CFile::modeWrite)) return false;
+
+	Size = size;
+	Count = 0;
+	Events = new TRACE_EVENT[Size];
+	Texts.RemoveAll();
+	Next.RemoveAll();
+	Buckets.SetSize(TEXT_BUCKETS);
+	for (int i = 0; i < TEXT_BUCKETS; i++) Buckets[i] = -1;
+	RuleTexts.RemoveAll();
+	ContextTexts.RemoveAll();
+
+	return true;
+}
+
+void TRACE_BUFFER::Close()
+{
+	if (Events == NULL) return;
+
+	Flush();
+	File.Close();
+	delete [] Events;
+	Events = NULL;
+	Size = 0;
+}
+
+void TRACE_BUFFER::Flush()
+{
+	File.Write(Events, Count * sizeof(TRACE_EVENT));
+	Count = 0;
+}
+
+int TRACE_BUFFER::GetText(CString Text)
+{
+	int Length = Text.GetLength();
+	int Bucket = lookup2(Text, Length, 0) & (TEXT_BUCKETS - 1);
+
+	for (int i = Buckets[Bucket]; i != -1; i = Next[i])
+		if (Texts[i] == Text) return i;
+
+	int Id = Texts.Add(Text);
+	Next.Add(Buckets[Bucket]);
+	Buckets[Bucket] = Id;
+
+	// the text follows its event, padded with zeros to whole events
+	TRACE_EVENT Event(EV_TEXT);
+	Event.Text = Id;
+	Event.Arg[0] = Length;
+	Add(Event);
+	for (int Done = 0; Done < Length; Done += sizeof(TRACE_EVENT))
+	{
+		if (Count == Size) Flush();
+		char * Slot = (char *)&Events[Count++];
+		int Part = Length - Done < (int)sizeof(TRACE_EVENT) ? Length - Done : sizeof(TRACE_EVENT);
+		memset(Slot, 0, sizeof(TRACE_EVENT));
+		memcpy(Slot, (LPCTSTR)Text + Done, Part);
+	}
+
+	return Id;
+}
+
+int TRACE_BUFFER::GetRuleText(RULE * Rule)
+{
+	int Index = Rule->get_index();
+	
+	while (RuleTexts.GetSize() <= Index) RuleTexts.Add(-1);
+	if (RuleTexts[Index] == -1) RuleTexts[Index] = GetText(Rule->GetName());
+	
+	return RuleTexts[Index];
+}
+
+// The property of a context does not change.  A context number is given
+// to another context after DropContext(), and all of them between two
+// optimizations, see EndInit()
+int TRACE_BUFFER::GetContextText(int ContextID)
+{
+	while (ContextTexts.GetSize() <= ContextID) ContextTexts.Add(-1);
+	if (ContextTexts[ContextID] == -1)
+		ContextTexts[ContextID] = GetText(Ctx->vc[ContextID]->GetPhysProp()->Dump());
+	
+	return ContextTexts[ContextID];
+}
+
+// the inputs of MExpr go to Arg[1..2] of Event, the rest to EV_INPUTS events
+void TRACE_BUFFER::Inputs(TRACE_EVENT & Event, M_EXPR * MExpr)
+{
+	int Arity = MExpr->GetArity();
+
+	Event.Arity = Arity;
+	for (int i = 0; i < Arity && i < 2; i++) Event.Arg[i + 1] = MExpr->GetInput(i);
+	Add(Event);
+
+	for (int First = 2; First < Arity; First += 3)
+	{
+		TRACE_EVENT More(EV_INPUTS);
+		for (int i = First; i < Arity && i < First + 3; i++)
+			More.Arg[i - First] = MExpr->GetInput(i);
+		Add(More);
+	}
+}
+
+void TRACE_BUFFER::NewQuery(int QueryNo)
+{
+	TRACE_EVENT Event(EV_QUERY);
+	Event.Arg[0] = QueryNo;
+	Add(Event);
+}
+
+void TRACE_BUFFER::NewGroup(GROUP * Group, M_EXPR * MExpr)
+{
+	TRACE_EVENT Event(EV_NEW_GROUP);
+	Event.Group = Group->GetGroupID();
+	Event.MExpr = int((size_t)MExpr);
+	Event.Text = GetText(MExpr->GetOp()->Dump());
+	Event.Arg[0] = GetText(Group->get_log_prop()->DumpCOVE());
+	Inputs(Event, MExpr);
+}
+
+void TRACE_BUFFER::NewMExpr(M_EXPR * MExpr, bool InGroup)
+{
+	TRACE_EVENT Event(EV_NEW_MEXPR);
+	Event.Kind = !InGroup;
+	Event.Group = MExpr->GetGrpID();
+	Event.MExpr = int((size_t)MExpr);
+	Event.Text = GetText(MExpr->GetOp()->Dump());
+	Inputs(Event, MExpr);
+}
+
+void TRACE_BUFFER::EndInit()
+{
+	TRACE_EVENT Event(EV_END_INIT);
+	Add(Event);
+	
+	// the contexts of an earlier optimization are gone
+	ContextTexts.RemoveAll();
+}
+
+void TRACE_BUFFER::PushTask(TASK * Task)
+{
+	TRACE_EVENT Event(EV_PUSH_TASK);
+	Task->Trace(Event);
+	Add(Event);
+}
+
+void TRACE_BUFFER::PopTask()
+{
+	TRACE_EVENT Event(EV_POP_TASK);
+	Add(Event);
+}
+
+void TRACE_BUFFER::NewWinner(M_EXPR * MExpr, PHYS_PROP * Prop, COST * Cost, bool Done)
+{
+	TRACE_EVENT Event(EV_NEW_WINNER);
+	Event.Kind = Done;
+	Event.Group = MExpr->GetGrpID();
+	Event.MExpr = int((size_t)MExpr);
+	Event.Arg[0] = GetText(Prop->Dump());
+	Event.Cost = Cost->GetValue();
+	Add(Event);
+}
+
+void TRACE_BUFFER::FireRule(RULE * Rule, M_EXPR * MExpr)
+{
+	TRACE_EVENT Event(EV_FIRE_RULE);
+	Event.Group = MExpr->GetGrpID();
+	Event.MExpr = int((size_t)MExpr);
+	Event.Text = GetRuleText(Rule);
+	Add(Event);
+}
+
+void TRACE_BUFFER::Prune(M_EXPR * MExpr, COST & CostSoFar, COST & UpperBd)
+{
+	TRACE_EVENT Event(EV_PRUNE);
+	Event.Group = MExpr->GetGrpID();
+	Event.MExpr = int((size_t)MExpr);
+	Event.Cost = CostSoFar.GetValue();
+	Event.Bound = UpperBd.GetValue();
+	Add(Event);
+}
@@ -0,0 +1,133 @@
+/*
+whatif.cpp -  implementation of costing a search space again after a change
+$Revision: 1 $
+Implements classes in whatif.h
+
+Columbia Optimizer Framework
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+*/
+
+#include "stdafx.h"
+#include "whatif.h"
+#include "ssp.h"
+#include "cat.h"
+#include "cm.h"
+#include "plan.h"
+
+#define LINEWIDTH 256		// buffer length of one text line
+
+WHAT_IF::WHAT_IF(CString FileName) : BaseCm(NULL), CardColl(-1), OldCard(0), OldUCard(0)
+{
+	char TextLine[LINEWIDTH];
+	FILE * fp = fopen(FileName, "r");
+	if (fp == NULL)
+	{
+		OUTPUT("Cannot read the what-if file %s\r\n", FileName);
+		return;
+	}
+	while (fgets(TextLine, LINEWIDTH, fp) != NULL)
+	{
+		if (IsCommentOrBlankLine(TextLine)) continue;
+		CString Line = SkipSpace(TextLine);
+		Line.TrimRight();
+		Changes.Add(Line);
+	}
+	fclose(fp);
+}
+
+bool WHAT_IF::Apply(CString Line, int & CollId)
+{
+	char TextLine[LINEWIDTH];
+	char Name[LINEWIDTH];
+	double Card;
+
+	// as fgets() gives it, ending in a newline
+	strncpy(TextLine, Line + "\n", LINEWIDTH - 1);
+	TextLine[LINEWIDTH - 1] = 0;
+	CollId = -1;
+
+	CM * Cm = new CM(*Ctx->Cm);
+	if (Cm->Read(TextLine))
+	{
+		BaseCm = Ctx->Cm;
+		Ctx->Cm = Cm;
+		return true;
+	}
+	delete Cm;
+
+	if (sscanf(Line, " Card: %255s %lf", Name, &Card) != 2 || Card <= 0) return false;
+	for (int i = 0; i < Ctx->CollTable.GetSize(); i++)
+		if (Ctx->CollTable[i] == Name && Ctx->Cat->GetCollProp(i) != NULL) CollId = i;
+	if (CollId < 0) return false;
+
+	COLL_PROP * CollProp = Ctx->Cat->GetCollProp(CollId);
+	if (CollProp->Card <= 0) return false;
+	CardColl = CollId;
+	OldCard = CollProp->Card;
+	OldUCard = CollProp->UCard;
+	CollProp->UCard = (float)(CollProp->UCard * Card / CollProp->Card);
+	CollProp->Card = (float)Card;
+	return true;
+}
+
+void WHAT_IF::Undo()
+{
+	if (BaseCm != NULL)
+	{
+		delete Ctx->Cm;
+		Ctx->Cm = BaseCm;
+		BaseCm = NULL;
+	}
+	if (CardColl >= 0)
+	{
+		COLL_PROP * CollProp = Ctx->Cat->GetCollProp(CardColl);
+		CollProp->Card = OldCard;
+		CollProp->UCard = OldUCard;
+		CardColl = -1;
+	}
+}
+
+// The search space was costed with the change before, which is taken back,
+// so the groups it changed are costed again too.  Stale is its collection,
+// -1 for the cost model, -2 if the search space is costed as it was.
+void WHAT_IF::Run()
+{
+	int Stale = -2;
+	for (int i = 0; i < Changes.GetSize(); i++)
+	{
+		CString os;
+		os.Format("========  WHAT-IF %s =========\r\n", Changes[i]);
+		OUTPUT("%s", os);
+
+		int CollId;
+		Undo();
+		if (!Apply(Changes[i], CollId))
+		{
+			OUTPUT("%s", "Neither a constant of the cost model nor the card of a collection\r\n");
+			continue;
+		}
+
+		CArray<int, int> CollIds;
+		if (CollId >= 0) CollIds.Add(CollId);
+		if (Stale >= 0 && Stale != CollId) CollIds.Add(Stale);
+
+		Ctx->TaskNo = 0;
+		Ctx->Memo_M_Exprs = 0;
+		Ctx->OptStat->DupMExpr = Ctx->OptStat->FiredRule = Ctx->OptStat->HashedMExpr = 0;
+		double StartMs = GetTimeMs();
+		int Count = Ctx->Ssp->Invalidate(CollIds, CollId == -1 || Stale == -1);
+		Ctx->Ssp->optimize();
+		double Ms = GetTimeMs() - StartMs;
+		Stale = CollId;
+
+		OUTPUT("Groups costed again : %d\r\n", Count);
+		OUTPUT("Costing elapsed time : %.3f ms\r\n", Ms);
+		PLAN * Plan = Ctx->Ssp->GetPlan(Ctx->Ssp->GetRootGID(), Ctx->vc[0]->GetPhysProp());
+		Plan->CopyOut(0);
+		delete Plan;
+	}
+	Undo();
+}
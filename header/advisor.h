@@ -0,0 +1,85 @@
+/*
+ADVISOR.H - Advising the indexes a workload gains most from
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  An advisor file gives the storage budget, in blocks, and the candidate
+  indexes, one per line: the collection, then the line of the catalog file
+  which would describe the index.
+
+	Budget:    20000
+	Index:     O  O_ORDERDATE  (OD)  btree  F
+	BitIndex:  C  CMKT_CCK  (CMKT)  C.CCK  (OP_EQ, (ATTR(C.CMKT)), (STR("BUILDING")))
+
+  INDEX_ADVISOR::Evaluate() tries the candidates in the search space of the
+  query just optimized.  A candidate is added to the catalog, and to each
+  range variable of its collection, and the groups which read them are
+  costed again with SSP::Invalidate() and optimize(), as WHAT_IF does.
+  Only the physical mexprs depend on the indexes, so the logical
+  properties are kept.  Each candidate is tried alone, then each pair of
+  those which lowered the cost of the query alone.
+
+  After the last query Recommend() picks the candidates greedily, the one
+  which saves the workload the most cost for each of its blocks first, as
+  long as they fit in the budget.  The cost of a query with a set of
+  candidates is taken as the lowest found with one or two of them, so no
+  set is costed as a whole.  An index takes Card / INDEX_BF blocks of the
+  cost model, a bit index Card / BIT_BF for each combination of values of
+  its bit attributes.
+*/
+
+#ifndef ADVISOR_H
+#define ADVISOR_H
+
+class INDEX_ADVISOR
+{
+private:
+	double	Budget;		// blocks, -1 for no budget
+
+	// the candidates, as the file gives them
+	CArray<CString, CString&> Colls;
+	CArray<CString, CString&> Lines;	// the rest of the line, as the catalog gives it
+	CArray<int, int>	Bit;			// 1 for a bit index
+	CArray<CString, CString&> Names;
+	CArray<double, double> Sizes;		// blocks, -1 until a query reads the collection
+
+	// the cost of each query evaluated, without a candidate, with each
+	// candidate and with each pair i < j, -1 if not tried or no plan was
+	// found.  The costs of query q begin at q * (1 + N + N * N).
+	CArray<int, int>	QueryNos;
+	CArray<double, double> Costs;
+
+	// the collection of candidate Cand and its range variables, in the
+	// catalog of the query.  False if the collection is not in it.
+	bool	Collections(int Cand, CArray<int, int> & CollIds);
+	// add candidate Cand to them, and their ids to CollIds.  False if it is
+	// no index of its collection, or one of that name is there already.
+	bool	Add(int Cand, CArray<int, int> & CollIds);
+	void	Remove(int Cand);
+	// the cost of the query with the Size candidates in Cands.  The groups
+	// Stale read were costed with other candidates before, so they are
+	// costed again too, and Stale becomes those the candidates are on.
+	// Groups is those costed again, -1 if a candidate cannot be added.
+	double	Cost(int * Cands, int Size, CArray<int, int> & Stale, int & Groups);
+
+	// the cost of query q with the candidates In, see Recommend()
+	double	QueryCost(int q, CArray<int, int> & In);
+	CString	Describe(int Cand);
+
+public:
+	INDEX_ADVISOR(CString FileName);
+
+	// try the candidates in Ctx->Ssp, query QueryNo of the batch.  It is
+	// left costed with the catalog as it is.
+	void	Evaluate(int QueryNo);
+
+	// print the candidates advised, and the cost of each query with them
+	void	Recommend();
+}; // class INDEX_ADVISOR
+
+#endif //ADVISOR_H
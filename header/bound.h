@@ -0,0 +1,91 @@
+/*
+BOUND.H - Lower bounds of the cost of the plans of a group
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  With CuCardPruning, O_INPUTS counts the lower bound of an input group not
+  optimized yet in the cost of the expression, so the tighter the bound the
+  sooner an expression which can not meet its context is pruned.  Each BOUND
+  is one way of deriving a bound, and LOWER_BOUND takes the largest of the
+  ways it is given:
+
+  fetch  - TouchCopyCost(), copying the output of the joins, plus, with
+		   CuCardPruning, FetchingCost(), fetching the cucard tuples of each
+		   table.  This is the bound GROUP used to find by itself.
+  scan   - fetch, with all the tuples of a table which has no index, since
+		   only a FILE_SCAN can read it
+  join   - for a join of two tables, the cheapest join algorithm in either
+		   order plus the bounds of the inputs it reads
+  winner - the cost of the done winner of the group for any property.  A
+		   failed search leaves the bound it failed in, which no plan
+		   meets either.
+
+  The bound of a group is found when the group is made, and raised by
+  GROUP::RefineLowerBd() during the search, when its inputs or itself may
+  have been optimized since.
+*/
+
+#ifndef BOUND_H
+#define BOUND_H
+
+class GROUP;
+
+// One way of deriving a lower bound
+class BOUND
+{
+public:
+	virtual ~BOUND() {};
+	virtual CString GetName() = 0;
+	// a cost no plan of Group is cheaper than, 0 if there is none
+	virtual double Find(GROUP * Group) = 0;
+}; // class BOUND
+
+class FETCH_BOUND : public BOUND
+{
+public:
+	CString GetName() { return "fetch"; };
+	double Find(GROUP * Group);
+};
+
+class SCAN_BOUND : public BOUND
+{
+public:
+	CString GetName() { return "scan"; };
+	double Find(GROUP * Group);
+};
+
+class JOIN_BOUND : public BOUND
+{
+public:
+	CString GetName() { return "join"; };
+	double Find(GROUP * Group);
+};
+
+class WINNER_BOUND : public BOUND
+{
+public:
+	CString GetName() { return "winner"; };
+	double Find(GROUP * Group);
+};
+
+// The bounds named in a list like "scan,join,winner"
+class LOWER_BOUND
+{
+private:
+	CArray<BOUND *, BOUND *> Bounds;
+
+public:
+	LOWER_BOUND(CString Names);
+	~LOWER_BOUND();
+
+	// the largest bound of Group
+	double Find(GROUP * Group);
+	CString Dump();
+}; // class LOWER_BOUND
+
+#endif //BOUND_H
@@ -0,0 +1,54 @@
+/*
+CONSOLE.H - Output window of the optimizer when it runs without MFC.
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  The OUTPUT and trace macros in defs.h write through OutputWindow.  In the
+  MFC front end that is the edit view of the application; in the headless
+  build it is this class, which writes to a stdio stream instead.
+*/
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+//##ModelId=3B0C085B03A3
+class CWcolView
+{
+private:
+	FILE *	Out;		// where the output goes, NULL means discard it
+	CString	Captured;	// output collected since the outermost BeginCapture()
+	CArray<int, int> CaptureStart;	// where each open capture starts in Captured
+
+public:
+	CWcolView(FILE * out = stdout) : Out(out) {};
+
+	// append output message to the stream.  Carriage returns are dropped.
+	void Print(LPCTSTR lpszMessage);
+	// nothing to clear on a stream
+	void ClearWindow() {};
+
+	// send the output to another stream, NULL to discard it
+	inline void SetOutput(FILE * out) { Out = out; };
+
+	// collect everything printed from now on, until EndCapture().  Captures
+	// may be nested, the outer one gets what the inner one gets too.
+	void BeginCapture()
+	{
+		if (CaptureStart.GetSize() == 0) Captured.Empty();
+		CaptureStart.Add(Captured.GetLength());
+	};
+	// stop collecting and return what was printed since BeginCapture()
+	CString EndCapture()
+	{
+		int Start = CaptureStart[CaptureStart.GetUpperBound()];
+		CaptureStart.RemoveAt(CaptureStart.GetUpperBound());
+		return Captured.Mid(Start);
+	};
+};
+
+#endif //CONSOLE_H
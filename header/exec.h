@@ -0,0 +1,153 @@
+/*
+EXEC.H - Running the plans of a query over generated data
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  EXEC runs a plan of TOP_PLANS, and prints each of its operators with its
+  estimated cost and card, the rows it made and the time it took, so the
+  costs of the plans can be checked against their run times.
+
+  The tables are made up from the catalog, each attribute with CuCard
+  values spread evenly over [Min, Max], each as often, in a random order.
+  A table sorted in the catalog is sorted on its keys.  At a Scale below 1
+  a table has Card * Scale rows, but at least the rows of a small table,
+  and an attribute with more values than that keeps Card * Scale of them,
+  on the same grid of values, so equal values still join.  The cards of
+  the plans are then about Card * Scale, which is what is printed.  A
+  string is one of the CuCard values, picked by a hash of the string, so
+  LIKE is an equality.  The aggregates and the functions are the sum of
+  their attributes.  A subquery in a predicate is run when its operator
+  is, and its first value, 0 without rows, is a constant.
+
+  The tables are made once for all the plans of a query, with their
+  indexes, and are not timed.  An operator's time is its own, not its
+  inputs'.  The execution stops at a relation of more than EXEC_MAX_CELLS
+  values, or at an operator it cannot run.
+*/
+
+#ifndef EXEC_H
+#define EXEC_H
+
+class PLAN_NODE;
+
+#define EXEC_MAX_CELLS	(1 << 25)	// values in a relation, 256MB
+#define EXEC_MIN_ROWS	1000		// smaller tables are not scaled
+
+typedef CArray<double, double> COLUMN;
+
+// The rows an operator makes, by column
+class RELATION
+{
+public:
+	CArray<int, int>	AttIds;		// of the columns
+	CArray<COLUMN *, COLUMN *> Columns;
+	int		Rows;
+
+	RELATION() : Rows(0) {};
+	~RELATION();
+
+	// the column of AttId, -1 if none
+	int		Find(int AttId);
+	// a new column of Rows values
+	COLUMN * AddColumn(int AttId);
+}; // class RELATION
+
+// A table made up from the catalog, with its indexes
+class TABLE
+{
+public:
+	int		CollId;
+	RELATION Rel;
+
+	// the values of each column are Min + k * Step, k in [0, CuCard), of
+	// which Distinct are used
+	CArray<int, int>	Distinct;
+	CArray<int, int>	CuCard;
+	CArray<double, double> Min;
+	CArray<double, double> Step;
+
+	// the rows sorted on a column, for each index
+	CArray<int, int>	IndexCol;
+	CArray<int *, int *> IndexRows;
+
+	TABLE(int CollId, double Scale);
+	~TABLE();
+
+	// value j of the Distinct values of column Col
+	double	Value(int Col, int j);
+	// the value of Col a string stands for
+	double	StrValue(int Col, CString Str);
+	// the rows sorted on column Col, an index of the catalog or a new one
+	int *	GetIndex(int Col);
+}; // class TABLE
+
+#define PRED_ATTR	100		// codes of PRED besides COMP_OP_CODE
+#define PRED_CONST	101
+
+// A predicate over the rows of a relation, 0 for false
+class PRED
+{
+public:
+	int		Code;		// COMP_OP_CODE, PRED_ATTR or PRED_CONST
+	double *	Data;	// the column of PRED_ATTR
+	double	Value;		// of PRED_CONST
+	CArray<double, double> Set;	// the values of a set, for OP_IN
+	PRED *	Inputs[2];
+
+	PRED(int code) : Code(code), Data(NULL), Value(0) { Inputs[0] = Inputs[1] = NULL; };
+	~PRED() { delete Inputs[0]; delete Inputs[1]; };
+
+	double	Eval(int Row);
+}; // class PRED
+
+class EXEC
+{
+private:
+	double	Scale;
+	CArray<TABLE *, TABLE *> Tables;	// made so far
+
+	// what each operator of the last plan did
+	CArray<PLAN_NODE *, PLAN_NODE *> Nodes;
+	CArray<int, int>	Rows;
+	CArray<double, double> Ms;
+	CString	Error;		// why the execution stopped
+
+	TABLE *	GetTable(int CollId);
+	// the column and the table of a base attribute, NULL if none
+	TABLE *	FindTable(int AttId, int & Col);
+
+	// make the tables and indexes Node reads, before it is timed
+	void	Prepare(PLAN_NODE * Node);
+	// the rows of the plan of Node, NULL when the execution stopped
+	RELATION * Run(PLAN_NODE * Node);
+	RELATION * RunOp(PLAN_NODE * Node, RELATION ** Inputs);
+
+	// the predicate Node over Rel, NULL if it cannot be run
+	PRED *	Compile(PLAN_NODE * Node, RELATION * Rel, int AttId = -1);
+	// the rows of Rel the predicate Node holds for
+	bool	Select(PLAN_NODE * Node, RELATION * Rel, CArray<int, int> & Out);
+
+	// the columns of Schema, of rows LRows of L and RRows of R
+	RELATION * Gather(PLAN_NODE * Node, RELATION * L, CArray<int, int> & LRows,
+				RELATION * R = NULL, CArray<int, int> * RRows = NULL);
+	// the pairs of the rows of L and R with equal LCols and RCols
+	bool	HashJoin(RELATION * L, int * LCols, RELATION * R, int * RCols, int Size,
+				CArray<int, int> * RSubset, CArray<int, int> & LRows, CArray<int, int> & RRows);
+	bool	TooMany(int Rows, int Cols);
+
+	void	Print(PLAN_NODE * Node, int tabs);
+
+public:
+	EXEC(double scale) : Scale(scale) {};
+	~EXEC();
+
+	// run plan No, Root, and print it
+	void	Execute(int No, PLAN_NODE * Root);
+}; // class EXEC
+
+#endif //EXEC_H
@@ -0,0 +1,87 @@
+/*
+GREEDY.H - Greedy plan of a query, for global epsilon pruning
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  With global epsilon pruning a plan cheaper than GlobalEpsBound is taken
+  to be optimal.  The bound used to come from a complete optimization of
+  the query without pruning.  GREEDY finds a plan in one pass over the
+  initial search space instead, with the FindLocalCost() of the physical
+  operators:
+
+  - WrittenCost() is the cost of the cheapest plan of the query in the
+	join order it is written in, with the cheapest algorithm of each
+	operator the rule set allows.  The groups of the initial search space
+	are used as they are, so this plan is one the search can find, and its
+	cost is an upper bound of the optimal cost.
+
+  - GreedyCost() orders the inputs of each tree of joins greedily: the
+	pair of inputs, joined by a predicate, with the smallest result is
+	joined first.  These joins are not in the search space, whose groups
+	get their logical properties from the first expression which makes
+	them, so the result estimates the optimal cost without bounding it.
+
+  A join of too many tables is not searched at all.  Its search space is
+  made from GreedyExpr() instead of the query, and FixedJoinOrder keeps
+  the rules from changing the order of its joins.
+*/
+
+#ifndef GREEDY_H
+#define GREEDY_H
+
+#include "tasks.h"
+
+class GREEDY
+{
+private:
+	PHYS_PROP *	Any;		// no property required, see RootCost()
+	bool	Reorder;		// may the rule set change the order of joins?
+
+	// cheapest plan of each group, [0] as written, [1] with greedy joins.
+	// -2 if not costed yet, -1 if there is no plan.
+	CArray<double, double> Costs[2];
+
+	double	GroupCost(GRP_ID GrpID, bool Greedy);
+	double	MExprCost(M_EXPR * MExpr, bool Greedy);
+	// the cost of input InputNo of Op, whose cheapest plan costs Cost, with
+	// the property Op requires of it
+	double	InputCost(PHYS_OP * Op, int InputNo, LOG_PROP * InputProp, double Cost);
+	// the cost of sorting a plan of LogProp, which costs Cost
+	double	SortCost(LOG_PROP * LogProp, double Cost);
+	// the cost with the property the query requires, see Ctx->vc[0]
+	double	RootCost(double Cost);
+	// the cost of Op, given the costs of its inputs
+	double	PhysCost(PHYS_OP * Op, LOG_PROP * LocalProp, LOG_PROP ** InputProps,
+				double * InputCosts);
+
+	// the inputs of the tree of joins at GrpID, and its predicates
+	void	JoinInputs(GRP_ID GrpID, CArray<GRP_ID, GRP_ID> & Inputs,
+				CArray<int, int> & LAttrs, CArray<int, int> & RAttrs);
+	// the cost of the greedy order, and its expression if Expr is not NULL
+	double	GreedyJoins(GRP_ID GrpID, EXPR ** Expr = NULL);
+	EXPR *	GroupExpr(GRP_ID GrpID);
+	double	JoinCost(int * LAttrs, int * RAttrs, int Size, LOG_PROP * LocalProp,
+				LOG_PROP * Left, double LeftCost, LOG_PROP * Right, double RightCost);
+
+public:
+	// Ctx->Ssp must hold the query, and Ctx->vc[0] the root context for
+	// the costs
+	GREEDY();
+	~GREEDY();
+
+	double	WrittenCost();	// -1 if the rule set has no plan
+	double	GreedyCost();
+
+	// the query with its joins in the greedy order, for SSP::Init(), which
+	// the caller deletes
+	EXPR *	GreedyExpr();
+	// the number of tables of the largest tree of joins in Expr
+	static int	JoinSize(EXPR * Expr);
+}; // class GREEDY
+
+#endif //GREEDY_H
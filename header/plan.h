@@ -0,0 +1,76 @@
+/*
+PLAN.H - The optimal plan of a query, as a tree
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  SSP::GetPlan() copies the winners of a query out of the search space
+  into a tree of PLANs, which does not point into the search space, so it
+  can be kept after the next query, written out and read back.
+  SSP::CopyOut() prints it.  Each node has the name of its operator and
+  its arguments, as Dump() prints them, the property required of its
+  group and the one it delivers, and the estimated card and cost.
+
+  The tree keeps the attributes by name, as the attributes the query makes
+  are not in the catalog, so it is written as JSON or into an ARCHIVE
+  without the catalog or the query.
+*/
+
+#ifndef PLAN_H
+#define PLAN_H
+
+// A physical property of a plan
+class PLAN_PROP
+{
+public:
+	ORDER	Order;
+	CArray<CString, CString&> Keys;
+	KeyOrderArray KeyOrder;		// of each key, when sorted
+
+	PLAN_PROP() : Order(any) {};
+	PLAN_PROP(PHYS_PROP * Prop);
+	PLAN_PROP(PLAN_PROP & other);
+
+	// as PHYS_PROP::Dump() prints the property
+	CString	Dump();
+	CString	DumpJSON();
+
+	void	Store(ARCHIVE & Ar);
+	void	Load(ARCHIVE & Ar);
+}; // class PLAN_PROP
+
+class PLAN
+{
+public:
+	CString	Name;		// of the operator, as GetName() gives it
+	CString	Text;		// the operator and its arguments, as Dump() prints them
+	GRP_ID	GrpID;
+	bool	Found;		// false when the group has no winner for Reqd
+	bool	IsItem;		// a predicate, or a constant
+	bool	IsConst;
+	PLAN_PROP *	Reqd;		// the property required of the group
+	// the property the plan delivers: the one its operator makes, where it
+	// makes one, else Reqd.  NULL for items.
+	PLAN_PROP *	Delivered;
+	double	Card;		// estimated, of the group; -1 for items
+	double	Cost;		// of the plan from this node down
+	CArray<PLAN *, PLAN *> Inputs;
+
+	PLAN(GRP_ID grpID, PLAN_PROP * reqd) : GrpID(grpID), Found(false), IsItem(false),
+		IsConst(false), Reqd(reqd), Delivered(NULL), Card(-1), Cost(0) {};
+	~PLAN();
+
+	// print the plan as SSP::CopyOut() does, indented by tabs
+	void	CopyOut(int tabs);
+
+	CString	DumpJSON();
+
+	void	Store(ARCHIVE & Ar);
+	static PLAN * Load(ARCHIVE & Ar);
+}; // class PLAN
+
+#endif //PLAN_H
@@ -0,0 +1,267 @@
+/*
+PORT.H - Portability layer for building the optimizer without MFC.
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  The optimizer core only uses a small part of MFC: CString, CArray, CFile
+  and a few typedefs and macros.  This file supplies minimal, source
+  compatible versions of them on top of the C++ standard library, so that
+  the core (SSP, tasks, rules, CAT, CM, QUERY) can be built as a library
+  on systems without MFC.  Only what the core uses is provided.
+*/
+
+#ifndef PORT_H
+#define PORT_H
+
+#include <assert.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+/*
+============================================================
+Windows types and macros
+============================================================
+*/
+typedef int				BOOL;
+typedef unsigned int	UINT;
+typedef unsigned long	DWORD;
+typedef const char *	LPCTSTR;
+typedef char *			LPTSTR;
+
+#ifndef TRUE
+#define TRUE	1
+#define FALSE	0
+#endif
+
+#define _MAX_PATH	4096
+
+#define ASSERT(f)	assert(f)
+#define VERIFY(f)	((void)(f))
+
+// integer to text, like the Microsoft C runtime function
+inline char * itoa(int value, char * buffer, int radix)
+{
+	assert(radix == 10);
+	sprintf(buffer, "%d", value);
+	return buffer;
+}
+
+// The input files were written on Windows and are read in text mode there,
+// which turns CR LF into LF.  Do the same, so the parsers see only LF.
+inline char * TextModeGets(char * s, int n, FILE * fp)
+{
+	char * r = fgets(s, n, fp);
+	if (r != NULL)
+	{
+		size_t len = strlen(s);
+		if (len >= 2 && s[len - 2] == '\r' && s[len - 1] == '\n')
+		{	s[len - 2] = '\n'; s[len - 1] = 0; }
+	}
+	return r;
+}
+#define fgets TextModeGets
+
+/*
+============================================================
+_ftime - time of day with millisecond resolution
+============================================================
+*/
+struct _timeb
+{
+	time_t			time;		// seconds since the epoch
+	unsigned short	millitm;	// milliseconds
+};
+
+inline void _ftime(struct _timeb * tb)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	tb->time = tv.tv_sec;
+	tb->millitm = (unsigned short)(tv.tv_usec / 1000);
+}
+
+/*
+============================================================
+CString
+============================================================
+Converts implicitly to const char *, like the MFC class, so it can be
+handed to the C string functions.  Format() accepts CString arguments
+for %s directly.
+*/
+class CString
+{
+private:
+	std::string Str;
+
+	// CString arguments of Format() are passed on as their character data
+	static const char * FormatArg(const CString & s) { return s.Str.c_str(); }
+	template <class T>
+	static const T & FormatArg(const T & t) { return t; }
+
+	void FormatV(const char * format, ...);
+
+public:
+	CString() {}
+	CString(const char * s) : Str(s ? s : "") {}
+	CString(const char * s, int n) : Str(s, n) {}
+	explicit CString(char c, int n = 1) : Str(n, c) {}
+	CString(const std::string & s) : Str(s) {}
+
+	inline operator const char * () const { return Str.c_str(); }
+
+	inline int GetLength() const { return (int)Str.size(); }
+	inline bool IsEmpty() const { return Str.empty(); }
+	inline void Empty() { Str.clear(); }
+
+	template <class I>
+	inline char operator[](I n) const { return Str[n]; }
+	inline char GetAt(int n) const { return Str[n]; }
+	inline void SetAt(int n, char c) { Str[n] = c; }
+
+	inline CString & operator=(const char * s) { Str = s ? s : ""; return *this; }
+	inline CString & operator+=(const CString & s) { Str += s.Str; return *this; }
+	inline CString & operator+=(const char * s) { Str += s; return *this; }
+	inline CString & operator+=(char c) { Str += c; return *this; }
+
+	inline int Compare(const char * s) const { return strcmp(Str.c_str(), s); }
+	inline int CompareNoCase(const char * s) const { return strcasecmp(Str.c_str(), s); }
+
+	inline CString Left(int n) const { return Str.substr(0, n); }
+	inline CString Right(int n) const
+	{ return n >= GetLength() ? Str : Str.substr(GetLength() - n); }
+	inline CString Mid(int first) const
+	{ return first >= GetLength() ? std::string() : Str.substr(first); }
+	inline CString Mid(int first, int n) const
+	{ return first >= GetLength() ? std::string() : Str.substr(first, n); }
+
+	inline int Find(char c) const
+	{ std::string::size_type p = Str.find(c); return p == std::string::npos ? -1 : (int)p; }
+	inline int Find(const char * s, int start = 0) const
+	{ std::string::size_type p = Str.find(s, start); return p == std::string::npos ? -1 : (int)p; }
+	inline int ReverseFind(char c) const
+	{ std::string::size_type p = Str.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+
+	void MakeUpper();
+	void MakeLower();
+	void TrimLeft();
+	void TrimRight();
+
+	// Direct access to the character buffer.  After writing into the buffer,
+	// call ReleaseBuffer() to fix up the length.
+	char * GetBuffer(int MinLength);
+	char * GetBufferSetLength(int NewLength);
+	void ReleaseBuffer(int NewLength = -1);
+
+	template <class... Args>
+	void Format(const char * format, const Args &... args)
+	{ FormatV(format, FormatArg(args)...); }
+
+	friend CString operator+(const CString & a, const CString & b) { return a.Str + b.Str; }
+	friend CString operator+(const CString & a, const char * b) { return a.Str + b; }
+	friend CString operator+(const char * a, const CString & b) { return a + b.Str; }
+	friend CString operator+(const CString & a, char b) { return a.Str + b; }
+
+	friend bool operator==(const CString & a, const CString & b) { return a.Str == b.Str; }
+	friend bool operator==(const CString & a, const char * b) { return a.Str == b; }
+	friend bool operator==(const char * a, const CString & b) { return b.Str == a; }
+	friend bool operator!=(const CString & a, const CString & b) { return a.Str != b.Str; }
+	friend bool operator!=(const CString & a, const char * b) { return a.Str != b; }
+	friend bool operator!=(const char * a, const CString & b) { return b.Str != a; }
+	friend bool operator<(const CString & a, const CString & b) { return a.Str < b.Str; }
+};
+
+/*
+============================================================
+CArray - dynamic array
+============================================================
+ARG_TYPE is accepted for source compatibility only.
+*/
+template <class TYPE, class ARG_TYPE>
+class CArray
+{
+private:
+	std::vector<TYPE> Data;
+
+public:
+	inline int GetSize() const { return (int)Data.size(); }
+	inline int GetUpperBound() const { return (int)Data.size() - 1; }
+	inline void SetSize(int NewSize, int GrowBy = -1)
+	{ (void)GrowBy; Data.resize(NewSize); }
+	inline void FreeExtra() { Data.shrink_to_fit(); }
+	inline void RemoveAll() { Data.clear(); }
+
+	inline TYPE & operator[](int n) { assert(n >= 0 && n < GetSize()); return Data[n]; }
+	inline const TYPE & operator[](int n) const { assert(n >= 0 && n < GetSize()); return Data[n]; }
+	inline TYPE & ElementAt(int n) { return (*this)[n]; }
+	inline TYPE GetAt(int n) const { return (*this)[n]; }
+	inline void SetAt(int n, ARG_TYPE e) { (*this)[n] = e; }
+	inline TYPE * GetData() { return Data.empty() ? NULL : &Data[0]; }
+
+	inline int Add(ARG_TYPE e) { Data.push_back(e); return GetSize() - 1; }
+	inline void SetAtGrow(int n, ARG_TYPE e)
+	{ if (n >= GetSize()) Data.resize(n + 1); Data[n] = e; }
+	inline void InsertAt(int n, ARG_TYPE e, int Count = 1)
+	{ Data.insert(Data.begin() + n, Count, e); }
+	inline void RemoveAt(int n, int Count = 1)
+	{ Data.erase(Data.begin() + n, Data.begin() + n + Count); }
+	inline void Copy(const CArray & other) { Data = other.Data; }
+	inline int Append(const CArray & other)
+	{ int old = GetSize(); Data.insert(Data.end(), other.Data.begin(), other.Data.end()); return old; }
+};
+
+/*
+============================================================
+CFile - binary file, buffered by stdio
+============================================================
+Writes to a file which is not open are silently dropped, so the trace
+macros can run before OutputFile has been opened.
+*/
+class CFile
+{
+private:
+	FILE * fp;
+
+	CFile(const CFile &);
+	CFile & operator=(const CFile &);
+
+public:
+	enum OpenFlags
+	{
+		modeRead		= 0x0000,
+		modeWrite		= 0x0001,
+		modeReadWrite	= 0x0002,
+		modeCreate		= 0x1000,
+		modeNoTruncate	= 0x2000
+	};
+
+	CFile() : fp(NULL) {}
+	~CFile() { Close(); }
+
+	BOOL Open(const char * FileName, UINT Flags);
+	void Close();
+	void Flush() { if (fp) fflush(fp); }
+	inline bool IsOpen() const { return fp != NULL; }
+
+	void Write(const void * Buf, UINT Count)
+	{ if (fp && Count) fwrite(Buf, 1, Count, fp); }
+	UINT Read(void * Buf, UINT Count)
+	{ return fp ? (UINT)fread(Buf, 1, Count, fp) : 0; }
+};
+
+#endif //PORT_H
@@ -0,0 +1,58 @@
+/*
+SPILL.H - Scratch file for the cold groups of the search space
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  Near the memory budget SSP::SpillCold() writes the logical mexprs of the
+  groups no task is using into a SPILL, and SSP::GetGroup() reads them back
+  when the group is used again.  The records are kept in a file mapped into
+  memory, so the system writes them out only when it needs the pages.  The
+  file is made for the process and removed when it is closed.
+  
+  The space of a record is not reused, except for the records at the end of
+  the file: when every record has been read back, the file starts over.
+*/
+
+#ifndef SPILL_H
+#define SPILL_H
+
+class SPILL
+{
+private:
+	CString	FileName;	// with the process id, so each worker has its own
+#ifdef _WIN32
+	HANDLE	File;
+	HANDLE	Mapping;
+#else
+	int		File;
+#endif
+	char *	Data;		// the file, mapped
+	long	Capacity;	// bytes in the file
+	long	Used;		// bytes of records, which start at 0
+	int		Records;	// records not freed yet
+	
+	bool	Grow(long Size);	// make room for Size bytes after Used
+	
+public:
+	SPILL();
+	~SPILL() { Close(); };
+	
+	bool	Open(CString Name);
+	void	Close();
+	
+	// copy the bytes of Ar into a new record, and return where it is
+	long	Put(ARCHIVE & Ar);
+	// the bytes of the record at Pos, valid until the next Put()
+	const char * Get(long Pos, int & Size);
+	// the record at Pos is no longer needed
+	void	Free(long Pos);
+	
+	inline long GetUsed() { return Used; };
+}; // class SPILL
+
+#endif //SPILL_H
@@ -0,0 +1,94 @@
+/*
+TOPK.H - The cheapest complete plans of a query
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  With TopPlans > 1 the winner of each group and property keeps the
+  TopPlans cheapest plans its search finds, see WINNER::AddOther(), and the
+  search prunes with the cost of the last of them instead of the cheapest.
+  TOP_PLANS puts them together into the TopPlans cheapest complete plans of
+  the query.  A plan costs the local cost of its M_EXPR plus the costs of
+  the plans of its inputs, so the cheapest plans of a group are found from
+  those of its inputs, keeping TopPlans of the sums as each input is added.
+  The searches were pruned, so these are the cheapest plans the search
+  kept, which need not be the next cheapest plans of the query.
+
+  Two plans with the same groups join the tables in the same order, maybe
+  with other algorithms or with the inputs of a join swapped.  With
+  DistinctJoins only the cheapest plan of each join order is kept, for each
+  group and property, so the plans of the query are in different orders.
+*/
+
+#ifndef TOPK_H
+#define TOPK_H
+
+// A node of a complete plan.  The M_EXPR is the winner's, the property
+// TOP_PLANS's.
+class PLAN_NODE
+{
+public:
+	GRP_ID		GrpID;
+	M_EXPR *	MExpr;
+	PHYS_PROP *	Prop;		// the property required of the group
+	double		Cost;		// of the plan from this node down
+	int			Arity;
+	PLAN_NODE **	Inputs;
+
+	PLAN_NODE(GRP_ID grpID, M_EXPR * mexpr, PHYS_PROP * prop, double cost, int arity);
+	~PLAN_NODE() { delete [] Inputs; };
+}; // class PLAN_NODE
+
+class TOP_PLANS
+{
+private:
+	int		Size;	// plans kept for each group and property
+	bool	Distinct;	// keep one plan of each join order
+
+	// the plans of each group and property, cheapest first, from First in
+	// Plans.  Count is -1 while they are being found.
+	CArray<GRP_ID, GRP_ID>	Groups;
+	CArray<PHYS_PROP *, PHYS_PROP *> Props;
+	CArray<int, int>		First;
+	CArray<int, int>		Count;
+	CArray<PLAN_NODE *, PLAN_NODE *> Plans;
+
+	// every node made, which TOP_PLANS deletes
+	CArray<PLAN_NODE *, PLAN_NODE *> Nodes;
+
+	int		Root;	// the plans of the query
+
+	// the number of the plans of GrpID with Prop, in Groups
+	int		Find(GRP_ID GrpID, PHYS_PROP * Prop);
+	// add the plans with MExpr at the top, of GrpID with Prop, to Best
+	void	Combine(GRP_ID GrpID, M_EXPR * MExpr, PHYS_PROP * Prop,
+				CArray<PLAN_NODE *, PLAN_NODE *> & Best);
+	// insert Node into Best, cheapest first, keeping Size of them
+	void	Insert(PLAN_NODE * Node, CArray<PLAN_NODE *, PLAN_NODE *> & Best);
+	PLAN_NODE * NewNode(GRP_ID GrpID, M_EXPR * MExpr, PHYS_PROP * Prop,
+				double Cost, int Arity);
+
+	void	CopyOut(PLAN_NODE * Node, int tabs);
+	// the groups of the plan of Node, the same for the plans in the same
+	// join order
+	void	Joins(PLAN_NODE * Node, CArray<int, int> & Used);
+	CString	GetJoins(PLAN_NODE * Node);
+
+public:
+	// the Size cheapest plans of the group GrpID with the property Prop
+	TOP_PLANS(GRP_ID GrpID, PHYS_PROP * Prop, int Size, bool Distinct);
+	~TOP_PLANS();
+
+	inline int GetSize() { return Count[Root]; };
+	inline double GetCost(int i) { return Plans[First[Root] + i]->Cost; };
+	inline PLAN_NODE * GetPlan(int i) { return Plans[First[Root] + i]; };
+
+	// print plan i, as SSP::CopyOut() prints the optimal plan
+	void	CopyOut(int i) { CopyOut(Plans[First[Root] + i], 0); };
+}; // class TOP_PLANS
+
+#endif //TOPK_H
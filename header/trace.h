@@ -0,0 +1,136 @@
+/*
+TRACE.H - Binary trace of the search
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  PTRACE and the COVE script format a line of text for each step of the
+  search and write it through CFile, which makes a traced optimization many
+  times slower.  The binary trace records a fixed size TRACE_EVENT for each
+  step instead.  The events are collected in a buffer, which is written to
+  the trace file when it is full.  Texts, such as the dump of an operator
+  or of a property, are written once and then referred to by number, and an
+  M_EXPR is referred to by its address, given with its text when it is made.
+  coltrace decodes the file into the COVE script or into a text trace.
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+class TASK;
+class GROUP;
+class M_EXPR;
+class RULE;
+class PHYS_PROP;
+class COST;
+
+// The kinds of event.  The fields of TRACE_EVENT used by each are listed.
+typedef enum TRACE_EVENT_TYPE
+{
+	EV_TEXT,		// Text is the number of a text of Arg[0] characters, which
+					// fill the following events
+	EV_QUERY,		// Arg[0] is the number of the query to be optimized
+	EV_NEW_GROUP,	// Group, MExpr, Text the operator, Arg[0] the logical
+					// properties as in the COVE script, Arg[1..2] the inputs
+	EV_NEW_MEXPR,	// Group, MExpr, Text the operator, Arg[1..2] the inputs,
+					// Kind 1 if the mexpr is not included in the group
+	EV_INPUTS,		// Arg[0..2] the next inputs of the last group or mexpr,
+					// when its Arity is over 2
+	EV_END_INIT,	// the initial search space is complete
+	EV_PUSH_TASK,	// Kind the TASK_KIND, Group, MExpr, Arg[0] the context,
+					// Arg[1] the parent task, Arg[2] the property or the rule,
+					// Cost the upper bound
+	EV_POP_TASK,	// TaskNo is the task about to be performed
+	EV_NEW_WINNER,	// Kind 1 if done, Group, MExpr, Arg[0] the property, Cost
+	EV_FIRE_RULE,	// Group, MExpr, Text the rule
+	EV_PRUNE		// Group, MExpr, Cost the cost so far, Bound the upper
+					// bound it exceeds
+} TRACE_EVENT_TYPE;
+
+// The tasks, for EV_PUSH_TASK
+typedef enum TASK_KIND
+{
+	TK_O_GROUP, TK_E_GROUP, TK_O_EXPR, TK_O_INPUTS, TK_APPLY_RULE
+} TASK_KIND;
+
+// One event, 48 bytes.  Numbers of texts are -1 when there is no text.
+class TRACE_EVENT
+{
+public:
+	unsigned char	Type;	// TRACE_EVENT_TYPE
+	unsigned char	Kind;	// TASK_KIND, or a flag
+	short	Arity;		// number of inputs of a group or mexpr
+	int		TaskNo;		// task being performed when the event happened
+	int		Group;
+	int		MExpr;		// the address of the M_EXPR, as in the COVE script
+	int		Text;
+	int		Arg[3];
+	double	Cost;
+	double	Bound;
+
+	TRACE_EVENT(TRACE_EVENT_TYPE type = EV_TEXT) : Type(type), Kind(0), Arity(0),
+		TaskNo(0), Group(-1), MExpr(0), Text(-1), Cost(0), Bound(0)
+	{ Arg[0] = Arg[1] = Arg[2] = -1; };
+}; // class TRACE_EVENT
+
+// The buffer of events and the table of texts written so far
+class TRACE_BUFFER
+{
+private:
+	CFile	File;
+	TRACE_EVENT * Events;
+	int		Size;		// capacity of Events
+	int		Count;		// events not written yet
+
+	// each text is written once, a hash table finds its number
+	CArray<CString, CString&> Texts;
+	CArray<int, int>	Next;		// next text in the same bucket
+	CArray<int, int>	Buckets;	// first text in the bucket, -1 if none
+	
+	// texts of the rules, by index, and of the properties of the contexts
+	CArray<int, int>	RuleTexts;
+	CArray<int, int>	ContextTexts;
+
+	void Flush();
+	void Inputs(TRACE_EVENT & Event, M_EXPR * MExpr);
+
+public:
+	TRACE_BUFFER() : Events(NULL), Size(0), Count(0) {};
+	~TRACE_BUFFER() { Close(); };
+
+	// start a trace file, with room for Size events before it is written
+	bool Open(CString FileName, int Size = 1 << 16);
+	void Close();
+
+	inline void Add(TRACE_EVENT & Event)
+	{
+		if (Count == Size) Flush();
+		Event.TaskNo = Ctx->TaskNo;
+		Events[Count++] = Event;
+	};
+
+	// the number of Text, writing it the first time it is seen
+	int GetText(CString Text);
+	int GetRuleText(RULE * Rule);
+	int GetContextText(int ContextID);
+	// the number of a deleted context will be given to another
+	void DropContext(int ContextID)
+	{ if (ContextID < ContextTexts.GetSize()) ContextTexts[ContextID] = -1; };
+
+	// the events of the search
+	void NewQuery(int QueryNo);
+	void NewGroup(GROUP * Group, M_EXPR * MExpr);
+	void NewMExpr(M_EXPR * MExpr, bool InGroup = true);
+	void EndInit();
+	void PushTask(TASK * Task);
+	void PopTask();
+	void NewWinner(M_EXPR * MExpr, PHYS_PROP * Prop, COST * Cost, bool Done);
+	void FireRule(RULE * Rule, M_EXPR * MExpr);
+	void Prune(M_EXPR * MExpr, COST & CostSoFar, COST & UpperBd);
+}; // class TRACE_BUFFER
+
+#endif //TRACE_H
@@ -0,0 +1,58 @@
+/*
+WHATIF.H - Costing the search space of a query again after a change
+$Revision: 1 $
+Columbia Optimizer Framework
+
+  A Joint Research Project of Portland State University
+  and the Oregon Graduate Institute
+  Directed by Leonard Shapiro and David Maier
+  Supported by NSF Grants IRI-9610013 and IRI-9619977
+
+  A what-if file lists changes, one per line: a constant of the cost
+  model, as a cost model file sets it, or the card of a collection, as
+  the query names it.
+
+	IO:          0.05
+	Card: A      10000
+
+  WHAT_IF::Run() makes each change alone in the search space of the query
+  just optimized, costs it again with SSP::Invalidate() and optimize(),
+  without exploring, and prints the groups costed again, the time and the
+  optimal plan.  A constant of the cost model costs every group again, a
+  card only the groups which read the collection, whose logical
+  properties are found again.  The UCard of the collection changes with
+  its card.  A range variable is a collection of its own, GET() copies
+  its properties, so it is changed by its own name.  Each change is taken back before the next one is made.
+*/
+
+#ifndef WHATIF_H
+#define WHATIF_H
+
+class CM;
+
+class WHAT_IF
+{
+private:
+	CArray<CString, CString&> Changes;	// the lines of the file
+
+	CM *	BaseCm;		// the cost model before the change, NULL if it is not changed
+	int		CardColl;	// the collection whose card is changed, -1 if none
+	float	OldCard;
+	float	OldUCard;
+
+	// make the change in Line, and return in CollId the collection it
+	// changes, -1 for the cost model.  False if Line is no change.
+	bool	Apply(CString Line, int & CollId);
+	// take the change back
+	void	Undo();
+
+public:
+	WHAT_IF(CString FileName);
+	~WHAT_IF() { Undo(); };
+
+	// cost Ctx->Ssp again with each change.  It is left costed with the
+	// last one.
+	void	Run();
+}; // class WHAT_IF
+
+#endif //WHATIF_H